@@ -9,7 +9,6 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <unistd.h> // usleep
 
 int main( void )
 {
@@ -26,6 +25,13 @@ int main( void )
         return -1;
     }
 
+    // 동기화 출력(DEC 2026)을 지원하는 터미널이면 프레임을 통째로 표시 (Tearing 방지)
+    cc_mode_state_e sync_state;
+    if( cc_device_query_mode( 2026, 100, &sync_state ) &&
+        ( sync_state == CC_MODE_STATE_SET || sync_state == CC_MODE_STATE_RESET ) ){
+        cc_buffer_set_term_caps( buffer, CC_TERM_CAPS_DEFAULT | CC_TERM_CAP_SYNC );
+    }
+
     int x  = 2, y  = 2;
     int dx = 1, dy = 1;
 
@@ -50,18 +56,24 @@ int main( void )
     cc_screen_set_back_color( c_black );
     cc_screen_clear();
 
+    // 약 60 FPS (프레임 사이에는 입력을 기다리며 잠듦)
+    cc_scheduler_t scheduler;
+    cc_scheduler_init( &scheduler, 60 );
+
     while( is_running )
     {
         // --- [입력 처리] ---
-        // 1ms 대기 (Non-blocking에 가까움)
-        cc_key_code_e key = cc_device_get_input( 1 );
+        // 다음 프레임 시각까지 입력 대기 (도착한 입력을 모두 처리한 뒤 그림)
+        cc_key_code_e key = cc_scheduler_wait( &scheduler );
 
         if( key != CC_KEY_NONE ){
             // Q 혹은 ESC 종료
             if( key == CC_KEY_ESC || key == CC_KEY_q ){
                 is_running = false;
             }
+            continue;
         }
+        if( !cc_scheduler_begin_frame( &scheduler ) ) continue;
 
         // --- [상태 업데이트] ---
         cc_term_size_t size = cc_screen_get_size();
@@ -106,8 +118,8 @@ int main( void )
 
         frame_count++;
 
-        // 약 60 FPS (16ms)
-        usleep( 16000 );
+        // 애니메이션이므로 매 프레임 다음 프레임을 요청
+        cc_scheduler_request_redraw( &scheduler );
     }
 
     // 정리 (Cleanup)
@@ -28,13 +28,9 @@ typedef enum {
 } app_mode_e;
 
 /**
- * @brief 캔버스 픽셀 구조체
+ * @brief 캔버스 픽셀 (화면 셀 형식 그대로 저장하여 렌더링 시 행 단위로 복사)
  */
-typedef struct {
-    char       _ch[5];
-    cc_color_t _fg;
-    cc_color_t _bg;
-} canvas_pixel_t;
+typedef cc_cell_t canvas_pixel_t;
 
 /**
  * @brief UI 클릭 영역 (Hitbox)
@@ -113,9 +109,7 @@ static void _update_brush_char( draw_app_t* app ) {
 }
 
 static void _init_pixel( canvas_pixel_t* px ) {
-    strcpy( px->_ch, " " );
-    px->_fg = CC_COLOR_WHITE;
-    px->_bg = CC_COLOR_BLACK;
+    cc_cell_init( px, ' ', &CC_COLOR_WHITE, &CC_COLOR_BLACK );
 }
 
 // -----------------------------------------------------------------------------
@@ -196,9 +190,9 @@ static void _action_draw( draw_app_t* app, int x, int y ) {
     int idx = y * app->_canvas_w + x;
     canvas_pixel_t* px = &app->_canvas_data[idx];
 
-    strcpy( px->_ch, app->_brush_char );
-    px->_fg = app->_current_color;
-    px->_bg = CC_COLOR_BLACK;
+    uint32_t glyph = ' ';
+    cc_glyph_decode( app->_brush_char, &glyph );
+    cc_cell_init( px, glyph, &app->_current_color, &CC_COLOR_BLACK );
 }
 
 static void _action_erase( draw_app_t* app, int center_x, int center_y ) {
@@ -501,25 +495,15 @@ static void _render( draw_app_t* app ) {
     cc_buffer_resize( app->_screen_buffer, size._cols, size._rows );
     _resize_canvas( app, size._cols, size._rows );
 
-    // 2. Clear Buffer
-    cc_buffer_clear( app->_screen_buffer, &CC_COLOR_BLACK );
-
-    // 3. Draw Canvas
+    // 2. Draw Canvas (캔버스가 화면 전체를 덮으므로 Clear 없이 행 단위로 셀 복사)
     int draw_h = ( app->_canvas_h < size._rows ) ? app->_canvas_h : size._rows;
     int draw_w = ( app->_canvas_w < size._cols ) ? app->_canvas_w : size._cols;
 
     for( int y = 0; y < draw_h; ++y ){
-        for( int x = 0; x < draw_w; ++x ){
-            int idx = y * app->_canvas_w + x;
-            canvas_pixel_t* px = &app->_canvas_data[idx];
-
-            if( strcmp( px->_ch, " " ) != 0 ) {
-                cc_buffer_draw_string( app->_screen_buffer, x, y, px->_ch, &px->_fg, &px->_bg );
-            }
-        }
+        cc_buffer_write_cells( app->_screen_buffer, 0, y, &app->_canvas_data[y * app->_canvas_w], draw_w );
     }
 
-    // 4. Eraser Overlay
+    // 3. Eraser Overlay
     if( app->_mode == APP_MODE_ERASER && app->_is_mouse_down ) {
         if( app->_mouse_cursor._y > 0 && app->_mouse_cursor._y < size._rows - 1 ) {
             int h = app->_eraser_size;
@@ -532,11 +516,11 @@ static void _render( draw_app_t* app ) {
         }
     }
 
-    // 5. UI
+    // 4. UI
     _draw_top_bar( app );
     _draw_bottom_bar( app );
 
-    // 6. Flush
+    // 5. Flush
     cc_buffer_flush( app->_screen_buffer );
 }
 
@@ -569,21 +553,30 @@ int main( void )
 
     app._screen_buffer = cc_buffer_create( 80, 24 );
 
-    // First Render
-    _render( &app );
+    // 입력이 있을 때와 시계가 바뀔 때만 그림 (그 외에는 입력 대기로 잠듦)
+    cc_scheduler_t scheduler;
+    cc_scheduler_init( &scheduler, 60 );
 
     // Main Loop
     while( app._is_running )
     {
-        // 10ms wait
-        cc_key_code_e key = cc_device_get_input( 10 );
+        cc_key_code_e key = cc_scheduler_wait( &scheduler );
         if( key != CC_KEY_NONE ) {
             cc_input_event_t evt;
             cc_device_inspect( key, &evt );
             _process_input( &app, &evt );
+            cc_scheduler_request_redraw( &scheduler );
+            continue;
         }
 
-        _render( &app );
+        if( cc_scheduler_begin_frame( &scheduler ) ) {
+            _render( &app );
+
+            // 상단 바 시계(초 단위) 갱신 예약
+            struct timespec now;
+            clock_gettime( CLOCK_REALTIME, &now );
+            cc_scheduler_request_redraw_after( &scheduler, 1000 - (int)( now.tv_nsec / 1000000 ) );
+        }
     }
 
     // Cleanup
@@ -64,6 +64,15 @@ typedef struct {
     // UI States
     bool        _is_red_border;
     bool        _is_green_border;
+
+    // 테두리/제목 기록 (창 위치나 강조 상태가 바뀔 때만 다시 기록)
+    cc_displaylist_t* _frame;
+    rect_t      _frame_rect;
+    int         _frame_state;
+
+    // 마지막으로 그린 상태 (바뀌면 이전/현재 영역만 다시 그림)
+    rect_t      _drawn_rect;
+    uint32_t    _drawn_sig;
 } inventory_t;
 
 typedef enum {
@@ -91,6 +100,13 @@ struct app_state_s {
 
     // Resources
     cc_buffer_t* _screen_buffer;
+    cc_displaylist_t* _chrome;    // 메뉴 바/로그 바 배경 (화면 크기가 바뀔 때만 다시 기록)
+    cc_term_size_t  _chrome_size;
+    cc_compositor_t* _compositor;
+    cc_layer_t*     _scene;       // 메뉴/창/로그 (입력으로 내용이 바뀔 때만 다시 그림)
+    cc_layer_t*     _ghost;       // 아이템 드래그 미리보기 (이동만 함)
+    bool            _scene_dirty;
+    char            _drawn_log[256];
 
     // Drag State
     drag_mode_e     _drag_mode;
@@ -182,6 +198,8 @@ static void _inv_init( inventory_t* inv, const char* title, int x, int y, int w
     _list_init( &inv->_items );
     inv->_is_red_border = false;
     inv->_is_green_border = false;
+    inv->_frame = cc_displaylist_create();
+    inv->_frame_state = -1;
 }
 
 static int _inv_get_calc_height( const inventory_t* inv ) {
@@ -216,40 +234,60 @@ static void _truncate_text( const char* src, int max_width, char* out_buf, size_
     snprintf( out_buf, buf_len, "%s", ".." );
 }
 
+static void _inv_record_frame( inventory_t* inv, const cc_color_t* fg, const cc_color_t* bg ) {
+    cc_displaylist_t* dl = inv->_frame;
+    cc_displaylist_clear( dl );
+
+    int x = inv->_rect.x, y = inv->_rect.y, w = inv->_rect.w, h = inv->_rect.h;
+    cc_rect_t box = cc_rect_make( x, y, w, h );
+    cc_displaylist_draw_box( dl, &box, CC_BOX_STYLE_HEAVY, fg, bg, NULL );
+    cc_displaylist_draw_string( dl, x + 1, y, "[-] ", fg, bg );
+    cc_displaylist_draw_string( dl, x, y + 2, "┣", fg, bg );
+    cc_displaylist_draw_string( dl, x + w - 1, y + 2, "┫", fg, bg );
+    cc_cell_t sep; cc_cell_init( &sep, 0x2501 /* ━ */, fg, bg );
+    cc_rect_t sep_rect = cc_rect_make( x + 1, y + 2, w - 2, 1 );
+    cc_displaylist_fill_rect( dl, &sep_rect, &sep );
+
+    int content_w = w - 2;
+    char display_title[MAX_TITLE_LEN];
+    _truncate_text( inv->_title, content_w, display_title, sizeof(display_title) );
+    int title_w = (int)cc_util_get_string_width( display_title );
+    cc_displaylist_draw_string( dl, x + ( w - title_w ) / 2, y + 1, display_title, &CC_COLOR_YELLOW, bg );
+}
+
 static void _inv_draw( inventory_t* inv, cc_buffer_t* buf ) {
     cc_color_t fg = CC_COLOR_WHITE;
     if( inv->_is_red_border ) fg = CC_COLOR_RED;
     else if( inv->_is_green_border ) fg = CC_COLOR_GREEN;
 
     cc_color_t bg = CC_COLOR_BLACK;
-    cc_color_t yellow = CC_COLOR_YELLOW;
-
-    cc_buffer_draw_box( buf, inv->_rect.x, inv->_rect.y, inv->_rect.w, inv->_rect.h, &fg, &bg, inv->_is_red_border );
-    cc_buffer_draw_string( buf, inv->_rect.x + 1, inv->_rect.y, "[-] ", &fg, &bg );
-    cc_buffer_draw_string( buf, inv->_rect.x, inv->_rect.y + 2, "┣", &fg, &bg );
-    cc_buffer_draw_string( buf, inv->_rect.x + inv->_rect.w - 1, inv->_rect.y + 2, "┫", &fg, &bg );
-    for( int i = inv->_rect.x + 1; i < inv->_rect.x + inv->_rect.w - 1; ++i ) {
-        cc_buffer_draw_string( buf, i, inv->_rect.y + 2, "━", &fg, &bg );
-    }
 
-    int content_w = inv->_rect.w - 2;
-    char display_title[MAX_TITLE_LEN];
-    _truncate_text( inv->_title, content_w, display_title, sizeof(display_title) );
-    int title_w = (int)cc_util_get_string_width( display_title );
-    int center_x = inv->_rect.x + ( inv->_rect.w - title_w ) / 2;
-    cc_buffer_draw_string( buf, center_x, inv->_rect.y + 1, display_title, &yellow, &bg );
-
-    for( int i = 0; i < inv->_items._count; ++i ) {
-        int row_y = inv->_rect.y + 3 + i;
-        if( row_y >= inv->_rect.y + inv->_rect.h - 1 ) break;
+    // 창 틀은 위치/강조 상태가 바뀔 때만 다시 기록하고 나머지 프레임은 재생만 함
+    int state = inv->_is_red_border ? 1 : ( inv->_is_green_border ? 2 : 0 );
+    if( state != inv->_frame_state || memcmp( &inv->_frame_rect, &inv->_rect, sizeof(rect_t) ) != 0 ) {
+        _inv_record_frame( inv, &fg, &bg );
+        inv->_frame_rect = inv->_rect;
+        inv->_frame_state = state;
+    }
+    cc_displaylist_replay( inv->_frame, buf, NULL );
+
+    // 창 영역 뷰 (좌표는 창 기준, 창 밖으로 넘치는 부분은 뷰가 잘라냄)
+    int w = inv->_rect.w;
+    int h = inv->_rect.h;
+    cc_rect_t win_rect = cc_rect_make( inv->_rect.x, inv->_rect.y, w, h );
+    cc_buffer_view_t win = cc_buffer_view_make( buf, &win_rect );
+
+    // 아이템 목록 (테두리 안쪽, 여백 1칸)
+    cc_rect_t list_rect = cc_rect_make( 2, 3, w - 3, h - 4 );
+    cc_buffer_view_t list = cc_buffer_view_sub( &win, &list_rect );
+    for( int i = 0; i < inv->_items._count && i < list_rect._h; ++i ) {
         char prefix[16]; snprintf( prefix, sizeof(prefix), "%d. ", i + 1 );
         int prefix_w = (int)cc_util_get_string_width( prefix );
-        int item_space = content_w - prefix_w - 1;
         char item_name[MAX_TEXT_LEN];
-        _truncate_text( inv->_items._data[i].name, item_space, item_name, sizeof(item_name) );
+        _truncate_text( inv->_items._data[i].name, list_rect._w - prefix_w, item_name, sizeof(item_name) );
         char line[MAX_TEXT_LEN * 2];
         snprintf( line, sizeof(line), "%s%s", prefix, item_name );
-        cc_buffer_draw_string( buf, inv->_rect.x + 2, row_y, line, &CC_COLOR_WHITE, &bg );
+        cc_buffer_view_draw_string( &list, 0, i, line, &CC_COLOR_WHITE, &bg );
     }
 }
 
@@ -455,12 +493,16 @@ static void _handle_mouse_drag( app_state_t* app, int mx, int my ) {
         }
     }
     else if( app->_drag_mode == DRAG_ITEM_MOVE ) {
+        // 미리보기는 레이어 이동으로 처리하므로, 테두리 강조가 바뀔 때만 창을 다시 그림
         for( int i = 0; i < app->_inv_count; ++i ) {
-            app->_inventories[i]._is_green_border = false;
-            if( i == app->_drag_target_idx ) continue;
-            rect_t check = app->_inventories[i]._rect;
-            if( app->_view_mode == VIEW_NORMAL ) check.h = _inv_get_calc_height( &app->_inventories[i] );
-            if( _rect_contains( check, mx, my ) ) app->_inventories[i]._is_green_border = true;
+            bool green = false;
+            if( i != app->_drag_target_idx ) {
+                rect_t check = app->_inventories[i]._rect;
+                if( app->_view_mode == VIEW_NORMAL ) check.h = _inv_get_calc_height( &app->_inventories[i] );
+                green = _rect_contains( check, mx, my );
+            }
+            if( app->_inventories[i]._is_green_border != green ) app->_scene_dirty = true;
+            app->_inventories[i]._is_green_border = green;
         }
     }
 }
@@ -525,36 +567,29 @@ static void _process_input( app_state_t* app, const cc_input_event_t* ev ) {
         if( ev->_data._mouse._button == CC_MOUSE_BTN_LEFT ) {
             if( ev->_data._mouse._action == CC_MOUSE_ACTION_PRESS ) _handle_mouse_press( app, mx, my );
         }
-        if( ev->_data._mouse._action == CC_MOUSE_ACTION_DRAG ) _handle_mouse_drag( app, mx, my );
+        if( ev->_data._mouse._action == CC_MOUSE_ACTION_DRAG ) {
+            _handle_mouse_drag( app, mx, my );
+            if( app->_drag_mode != DRAG_ITEM_MOVE ) app->_scene_dirty = true;
+            return;
+        }
         else if( ev->_data._mouse._action == CC_MOUSE_ACTION_RELEASE ) _handle_mouse_release( app );
     }
+    app->_scene_dirty = true;
 }
 
 // -----------------------------------------------------------------------------
 // Rendering
 // -----------------------------------------------------------------------------
 
-static void _render( app_state_t* app ) {
-    // 1. Update Heights
-    for( int i = 0; i < app->_inv_count; ++i ) {
-        bool resizing = ( app->_drag_mode == DRAG_WINDOW_RESIZE && app->_drag_target_idx == i );
-        if( app->_view_mode == VIEW_NORMAL && !resizing ) {
-            _inv_update_height( &app->_inventories[i] );
-        }
-    }
-
-    cc_term_size_t size = cc_screen_get_size();
-    cc_buffer_resize( app->_screen_buffer, size._cols, size._rows );
-    cc_buffer_clear( app->_screen_buffer, &CC_COLOR_BLACK );
+static void _record_chrome( app_state_t* app, cc_term_size_t size, const cc_color_t* log_bg ) {
+    cc_displaylist_t* dl = app->_chrome;
+    cc_displaylist_clear( dl );
 
-    // 2. Draw Inventories
-    for( int i = 0; i < app->_inv_count; ++i ) {
-        _inv_draw( &app->_inventories[i], app->_screen_buffer );
-    }
-
-    // 3. Draw Menu Bar (Data Driven)
+    // Menu Bar (Data Driven)
     cc_color_t blue = CC_COLOR_BLUE; cc_color_t white = CC_COLOR_WHITE;
-    for( int x = 0; x < size._cols; ++x ) cc_buffer_draw_string( app->_screen_buffer, x, 0, " ", &white, &blue );
+    cc_cell_t bar; cc_cell_init( &bar, ' ', &white, &blue );
+    cc_rect_t bar_rect = cc_rect_make( 0, 0, size._cols, 1 );
+    cc_displaylist_fill_rect( dl, &bar_rect, &bar );
 
     int cx = 1;
     for( int i = 0; i < app->_menu_count; ++i ) {
@@ -565,37 +600,133 @@ static void _render( app_state_t* app ) {
         m->_x = cx;
         m->_w = w;
 
-        cc_buffer_draw_string( app->_screen_buffer, cx, 0, m->_label, &white, &blue );
+        cc_displaylist_draw_string( dl, cx, 0, m->_label, &white, &blue );
         cx += w;
 
         if( i < app->_menu_count - 1 ) {
-            cc_buffer_draw_string( app->_screen_buffer, cx++, 0, "|", &white, &blue );
+            cc_displaylist_draw_string( dl, cx++, 0, "|", &white, &blue );
         }
     }
 
-    // 4. Draw Log
-    int by = size._rows - 1;
+    // Log Bar Background
+    cc_cell_t log_cell; cc_cell_init( &log_cell, ' ', &white, log_bg );
+    cc_rect_t log_rect = cc_rect_make( 0, size._rows - 1, size._cols, 1 );
+    cc_displaylist_fill_rect( dl, &log_rect, &log_cell );
+}
+
+static uint32_t _inv_signature( const inventory_t* inv ) {
+    // 강조 상태와 아이템 이름(순서 포함)의 FNV-1a 해시
+    uint32_t h = 2166136261u;
+    h = ( h ^ (uint32_t)( inv->_is_red_border | ( inv->_is_green_border << 1 ) ) ) * 16777619u;
+    for( int i = 0; i < inv->_items._count; ++i ) {
+        for( const char* c = inv->_items._data[i].name; *c; ++c ) h = ( h ^ (unsigned char)*c ) * 16777619u;
+        h = ( h ^ 0xFFu ) * 16777619u;
+    }
+    return h;
+}
+
+static void _damage_scene( app_state_t* app, cc_buffer_t* buf, cc_term_size_t size ) {
+    // 위치/내용이 바뀐 창은 이전 위치와 현재 위치를 다시 그림
+    for( int i = 0; i < app->_inv_count; ++i ) {
+        inventory_t* inv = &app->_inventories[i];
+        uint32_t sig = _inv_signature( inv );
+        if( sig == inv->_drawn_sig && memcmp( &inv->_drawn_rect, &inv->_rect, sizeof(rect_t) ) == 0 ) continue;
+
+        cc_rect_t old_rect = cc_rect_make( inv->_drawn_rect.x, inv->_drawn_rect.y, inv->_drawn_rect.w, inv->_drawn_rect.h );
+        cc_rect_t new_rect = cc_rect_make( inv->_rect.x, inv->_rect.y, inv->_rect.w, inv->_rect.h );
+        cc_buffer_damage( buf, &old_rect );
+        cc_buffer_damage( buf, &new_rect );
+        inv->_drawn_rect = inv->_rect;
+        inv->_drawn_sig = sig;
+    }
+
+    if( strcmp( app->_drawn_log, app->_log_msg ) != 0 ) {
+        cc_rect_t log_rect = cc_rect_make( 0, size._rows - 1, size._cols, 1 );
+        cc_buffer_damage( buf, &log_rect );
+        strcpy( app->_drawn_log, app->_log_msg );
+    }
+}
+
+static void _render_scene( app_state_t* app, cc_buffer_t* buf, cc_term_size_t size ) {
+    // 현재 Clip 영역만 다시 그림 (영역과 겹치지 않는 창은 건너뜀)
+    cc_rect_t area = cc_buffer_get_clip( buf );
+    cc_buffer_clear_rect( buf, &area, &CC_COLOR_BLACK );
+
+    // 2. Draw Inventories
+    for( int i = 0; i < app->_inv_count; ++i ) {
+        rect_t r = app->_inventories[i]._rect;
+        if( cc_rect_is_empty( cc_rect_intersect( cc_rect_make( r.x, r.y, r.w, r.h ), area ) ) ) continue;
+        _inv_draw( &app->_inventories[i], buf );
+    }
+
+    // 3. Draw Menu Bar & Log Bar Background (화면 크기가 바뀔 때만 기록)
+    cc_color_t white = CC_COLOR_WHITE;
     cc_color_t gray; cc_color_init_rgb(&gray, 40, 40, 40);
-    for( int x = 0; x < size._cols; ++x ) cc_buffer_draw_string( app->_screen_buffer, x, by, " ", &white, &gray );
+    int by = size._rows - 1;
+    if( app->_chrome_size._cols != size._cols || app->_chrome_size._rows != size._rows ) {
+        _record_chrome( app, size, &gray );
+        app->_chrome_size = size;
+    }
+    cc_displaylist_replay( app->_chrome, buf, NULL );
+
+    // 4. Draw Log
     char log_buf[512]; snprintf( log_buf, sizeof(log_buf), " Log: %s", app->_log_msg );
-    cc_buffer_draw_string( app->_screen_buffer, 1, by, log_buf, &white, &gray );
+    cc_buffer_draw_string( buf, 1, by, log_buf, &white, &gray );
+}
 
-    // 5. Drag Overlay
-    if( app->_drag_mode == DRAG_ITEM_MOVE ) {
-        int x = app->_mouse_cursor._x + 2;
-        int y = app->_mouse_cursor._y + 1;
+static void _render( app_state_t* app ) {
+    cc_term_size_t size = cc_screen_get_size();
+    cc_buffer_resize( app->_screen_buffer, size._cols, size._rows );
+
+    // 1. Update Heights
+    for( int i = 0; i < app->_inv_count; ++i ) {
+        bool resizing = ( app->_drag_mode == DRAG_WINDOW_RESIZE && app->_drag_target_idx == i );
+        if( app->_view_mode == VIEW_NORMAL && !resizing ) {
+            _inv_update_height( &app->_inventories[i] );
+        }
+    }
+
+    // 2~4. Scene Layer (바뀐 영역만 다시 그림, 크기가 바뀌면 전체)
+    cc_buffer_t* scene = app->_scene->_surface;
+    bool resized = ( scene->_width != size._cols || scene->_height != size._rows );
+    if( resized ) {
+        cc_layer_resize( app->_scene, size._cols, size._rows );
+        cc_rect_t full = cc_rect_make( 0, 0, size._cols, size._rows );
+        cc_buffer_damage( scene, &full );
+    }
+    if( resized || app->_scene_dirty ) {
+        _damage_scene( app, scene, size );
+
+        cc_rect_t rects[CC_DAMAGE_RECTS_MAX];
+        int count = cc_buffer_get_damage( scene, rects, CC_DAMAGE_RECTS_MAX );
+        for( int i = 0; i < count; ++i ) {
+            cc_buffer_push_clip( scene, &rects[i] );
+            _render_scene( app, scene, size );
+            cc_buffer_pop_clip( scene );
+        }
+        app->_scene_dirty = false;
+    }
+
+    // 5. Drag Overlay (드래그 시작 시 한 번 그리고 이후에는 옮기기만 함)
+    if( app->_drag_mode == DRAG_ITEM_MOVE && !app->_ghost->_visible ) {
         char content[MAX_TEXT_LEN + 2]; snprintf( content, sizeof(content), " %s ", app->_dragging_item.name );
         int w = (int)cc_util_get_string_width( content );
         cc_color_t box_bg = CC_COLOR_BLACK; cc_color_t box_fg = CC_COLOR_CYAN;
-        char top[128] = "┌"; for(int k=0;k<w;k++) strcat(top, "─"); strcat(top, "┐");
-        char bot[128] = "└"; for(int k=0;k<w;k++) strcat(bot, "─"); strcat(bot, "┘");
-        cc_buffer_draw_string( app->_screen_buffer, x, y, top, &box_fg, &box_bg );
-        cc_buffer_draw_string( app->_screen_buffer, x, y+1, "│", &box_fg, &box_bg );
-        cc_buffer_draw_string( app->_screen_buffer, x+1, y+1, content, &box_fg, &box_bg );
-        cc_buffer_draw_string( app->_screen_buffer, x+1+w, y+1, "│", &box_fg, &box_bg );
-        cc_buffer_draw_string( app->_screen_buffer, x, y+2, bot, &box_fg, &box_bg );
+        cc_buffer_t* ghost = app->_ghost->_surface;
+        cc_rect_t box = cc_rect_make( 0, 0, w + 2, 3 );
+        cc_layer_resize( app->_ghost, w + 2, 3 );
+        cc_buffer_draw_box_style( ghost, &box, CC_BOX_STYLE_LIGHT, &box_fg, &box_bg, NULL );
+        cc_buffer_draw_string( ghost, 1, 1, content, &box_fg, &box_bg );
+        cc_layer_set_visible( app->_ghost, true );
+    }
+    if( app->_drag_mode == DRAG_ITEM_MOVE ) {
+        cc_layer_move( app->_ghost, app->_mouse_cursor._x + 2, app->_mouse_cursor._y + 1 );
+    } else {
+        cc_layer_set_visible( app->_ghost, false );
     }
 
+    // 6. Compose & Flush (바뀐 영역만 합성/출력)
+    cc_compositor_compose( app->_compositor );
     cc_buffer_flush( app->_screen_buffer );
 }
 
@@ -608,6 +739,7 @@ void app_init(app_state_t* app) {
 
     app->_is_running = true;
     app->_need_render = true;
+    app->_scene_dirty = true;
     app->_view_mode = VIEW_NORMAL;
     app->_drag_mode = DRAG_NONE;
     app->_drag_target_idx = -1;
@@ -644,6 +776,14 @@ void app_init(app_state_t* app) {
     cc_screen_set_back_color( &CC_COLOR_BLACK );
     cc_screen_clear();
     app->_screen_buffer = cc_buffer_create( 80, 24 );
+    app->_chrome = cc_displaylist_create();
+    app->_compositor = cc_compositor_create( app->_screen_buffer, &CC_COLOR_BLACK );
+    cc_rect_t full = cc_rect_make( 0, 0, 80, 24 );
+    cc_rect_t none = cc_rect_make( 0, 0, 1, 1 );
+    app->_scene = cc_compositor_add_layer( app->_compositor, &full, 0 );
+    cc_buffer_damage( app->_scene->_surface, &full ); // 첫 프레임은 전체를 그림
+    app->_ghost = cc_compositor_add_layer( app->_compositor, &none, 1 );
+    cc_layer_set_visible( app->_ghost, false );
 }
 
 void app_cleanup(app_state_t* app) {
@@ -652,8 +792,11 @@ void app_cleanup(app_state_t* app) {
     cc_screen_clear();
     for( int i = 0; i < app->_inv_count; ++i ) {
         _list_free( &app->_inventories[i]._items );
+        cc_displaylist_destroy( app->_inventories[i]._frame );
     }
+    cc_displaylist_destroy( app->_chrome );
     free( app->_inventories );
+    cc_compositor_destroy( app->_compositor );
     cc_buffer_destroy( app->_screen_buffer );
     cc_device_deinit();
 }
@@ -662,8 +805,12 @@ int main( void ) {
     app_state_t app;
     app_init( &app );
 
+    // 입력이 없으면 잠들고, 몰려온 입력(드래그 등)은 한 프레임으로 합쳐 그림
+    cc_scheduler_t scheduler;
+    cc_scheduler_init( &scheduler, 60 );
+
     while( app._is_running ) {
-        cc_key_code_e key = cc_device_get_input( 10 );
+        cc_key_code_e key = cc_scheduler_wait( &scheduler );
         if( key != CC_KEY_NONE ) {
             cc_input_event_t evt;
             cc_device_inspect( key, &evt );
@@ -671,9 +818,12 @@ int main( void ) {
             app._need_render = true;
         }
         if( app._need_render ) {
-            _render( &app );
+            cc_scheduler_request_redraw( &scheduler );
             app._need_render = false;
         }
+        if( key == CC_KEY_NONE && cc_scheduler_begin_frame( &scheduler ) ) {
+            _render( &app );
+        }
     }
 
     app_cleanup( &app );
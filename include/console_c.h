@@ -14,9 +14,15 @@ extern "C" {
 // Core Modules
 #include "console_c/cc_color.h"
 #include "console_c/cc_util.h"
+#include "console_c/cc_glyph.h"
+#include "console_c/cc_rect.h"
+#include "console_c/cc_sink.h"
 #include "console_c/cc_screen.h" // Includes cc_device definitions (Types)
 #include "console_c/cc_device.h"
 #include "console_c/cc_buffer.h"
+#include "console_c/cc_layer.h"
+#include "console_c/cc_displaylist.h"
+#include "console_c/cc_scheduler.h"
 
 #ifdef __cplusplus
 }
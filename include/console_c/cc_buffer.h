@@ -9,21 +9,85 @@
  * ------------------------------------------------------------------------------------ */
 
 #include "console_c/cc_color.h"
+#include "console_c/cc_rect.h"
+#include "console_c/cc_sink.h"
 #include <stdbool.h>
 #include <stdint.h>
 
 /**
- * @brief 화면의 한 칸을 나타내는 구조체
- * @details 단일 UTF-8 문자를 저장하기 위해 고정된 크기의 char 배열을 사용합니다.
+ * @brief 셀 플래그 (cc_cell_t::_glyph 의 상위 8비트)
+ */
+#define CC_CELL_FLAG_WIDE_TRAIL 0x01u /**< 2칸짜리 문자의 뒷부분 */
+
+#define CC_CELL_GLYPH_MASK    0x00FFFFFFu /**< _glyph 중 글리프 핸들 영역 */
+#define CC_CELL_GLYPH_INVALID 0x00FFFFFFu /**< 어떤 글리프와도 같지 않은 값 (Front를 무효화할 때 사용) */
+#define CC_CELL_FLAG_SHIFT    24          /**< _glyph 중 플래그 영역 시작 비트 */
+#define CC_CELL_COLOR_MASK    0x00FFFFFFu /**< _fg/_bg 중 RGB 영역 */
+#define CC_CELL_TYPE_SHIFT    24          /**< _fg/_bg 중 색상 타입 영역 시작 비트 */
+
+/**
+ * @brief 터미널 기능 플래그 (cc_buffer_set_term_caps)
+ * @details flush가 사용할 수 있는 제어 시퀀스를 지정합니다.
+ * ECH/EL은 지운 칸을 현재 배경색으로 채우는 터미널(BCE)을 전제로 합니다.
+ */
+#define CC_TERM_CAP_ECH  0x01u /**< 문자 지우기 \033[nX (같은 배경색의 공백 구간) */
+#define CC_TERM_CAP_EL   0x02u /**< 줄 끝까지 지우기 \033[K (행 끝까지 이어진 공백 구간) */
+#define CC_TERM_CAP_REP  0x04u /**< 직전 문자 반복 \033[nb (같은 문자 구간) */
+#define CC_TERM_CAP_SYNC 0x08u /**< 동기화 출력 \033[?2026h/l 로 프레임을 감쌈 (cc_device_query_mode 로 지원 확인) */
+#define CC_TERM_CAP_RESIZE_KEEP 0x10u /**< 크기 변경 후에도 왼쪽 위 영역의 내용을 그대로 유지 (줄 재배치(Reflow)를 하지 않는 터미널, 직접 켜야 함) */
+
+#define CC_TERM_CAPS_DEFAULT ( CC_TERM_CAP_ECH | CC_TERM_CAP_EL ) /**< 기본값 (REP/SYNC는 지원하지 않는 터미널이 많고, 대부분의 터미널은 크기 변경 시 줄을 재배치하므로 RESIZE_KEEP 제외) */
+
+/**
+ * @brief 화면의 한 칸을 나타내는 압축 구조체 (12 bytes)
+ * @details 모든 필드를 32비트 정수로 압축하여 셀 비교가 정수 비교 3회로 끝나고,
+ * 캐시 라인(64B) 하나에 5개 이상의 셀이 들어가도록 했습니다.
+ * - _glyph : [31:24] 셀 플래그 | [23:0] 글리프 ID (코드포인트, 또는 cc_glyph 에 등록된 결합 문자 ID)
+ * - _fg/_bg: [31:24] cc_color_type_e | [23:0] RGB (0xRRGGBB)
  */
 typedef struct
 {
-    char       _ch[5];         /**< 출력할 문자 (UTF-8, Max 4bytes + Null) */
-    cc_color_t _fg;            /**< 글자색 */
-    cc_color_t _bg;            /**< 배경색 */
-    bool       _is_wide_trail; /**< 2칸짜리 문자의 뒷부분인지 여부 */
+    uint32_t _glyph; /**< 플래그 + 글리프 핸들 */
+    uint32_t _fg;    /**< 압축된 글자색 */
+    uint32_t _bg;    /**< 압축된 배경색 */
 } cc_cell_t;
 
+/**
+ * @brief 한 행에서 변경된 열 범위 (Dirty Span)
+ * @details _min_x > _max_x 이면 변경 없음을 의미합니다.
+ */
+typedef struct
+{
+    int _min_x; /**< 변경된 최소 열 */
+    int _max_x; /**< 변경된 최대 열 (포함) */
+} cc_dirty_span_t;
+
+/**
+ * @brief 다음 flush 시작 시 터미널로 보낼 스크롤 명령 (DECSTBM + SU/SD)
+ */
+typedef struct
+{
+    int _top;    /**< 스크롤 영역 첫 행 (0-based) */
+    int _bottom; /**< 스크롤 영역 마지막 행 (포함) */
+    int _dy;     /**< 이동량 (음수 = 위로, 양수 = 아래로) */
+} cc_scroll_op_t;
+
+#define CC_SCROLL_OPS_MAX 8 /**< flush 사이에 쌓아둘 수 있는 스크롤 명령 수 */
+#define CC_CLIP_STACK_MAX 16 /**< cc_buffer_push_clip 으로 겹쳐 쌓을 수 있는 영역 수 */
+#define CC_DAMAGE_RECTS_MAX 8 /**< cc_buffer_get_damage 최대 사각형 수 (작을수록 사각형이 커짐) */
+
+/**
+ * @brief 박스 테두리 모양
+ */
+typedef enum
+{
+    CC_BOX_STYLE_HEAVY   = 0, /**< ┏━┓┃┗┛ (cc_buffer_draw_box 기본값) */
+    CC_BOX_STYLE_LIGHT   = 1, /**< ┌─┐│└┘ */
+    CC_BOX_STYLE_DOUBLE  = 2, /**< ╔═╗║╚╝ */
+    CC_BOX_STYLE_ROUNDED = 3, /**< ╭─╮│╰╯ */
+    CC_BOX_STYLE_COUNT
+} cc_box_style_e;
+
 /**
  * @brief 더블 버퍼링 관리 구조체
  */
@@ -31,6 +95,7 @@ typedef struct
 {
     int        _width;        /**< 버퍼 너비 */
     int        _height;       /**< 버퍼 높이 */
+    int        _capacity;     /**< Front/Back에 할당된 셀 수 (줄어들 때는 재할당하지 않음) */
     
     /**
      * @brief Front Buffer (현재 화면 상태)
@@ -43,8 +108,61 @@ typedef struct
      * @details 1차원 배열로 관리 (index = y * width + x)
      */
     cc_cell_t* _back_buffer;  
+
+    /**
+     * @brief 변경 행 비트맵 (bit y = 마지막 flush 이후 y행이 수정됨)
+     * @details flush는 비트가 켜진 행의 _dirty_spans 범위만 비교합니다.
+     */
+    uint64_t*        _dirty_rows;
+    cc_dirty_span_t* _dirty_spans; /**< 행별 변경 열 범위 (height개) */
+    uint64_t*        _row_hashes;  /**< 스크롤 감지용 행 해시 (Front height개 + Back height개) */
+
+    /**
+     * @brief 터미널 스크롤 명령 대기열
+     * @details cc_buffer_scroll_region 이 Front/Back을 즉시 옮기고, 터미널에는 다음 flush 때 보냅니다.
+     */
+    cc_scroll_op_t _scroll_ops[CC_SCROLL_OPS_MAX];
+    int            _scroll_op_count;
+    bool           _scroll_detect; /**< flush 시 행 이동 자동 감지 여부 */
+
+    /**
+     * @brief 그리기 영역 제한(Clip) 스택
+     * @details 각 항목은 push 시점의 영역과 바로 아래 항목의 교집합입니다.
+     * draw 함수는 _clip (스택 맨 위와 버퍼 범위의 교집합) 밖의 셀을 건드리지 않습니다.
+     */
+    cc_rect_t _clip_stack[CC_CLIP_STACK_MAX];
+    int       _clip_depth;
+    cc_rect_t _clip;
+
+    /**
+     * @brief flush 출력(ANSI 인코딩) 버퍼
+     * @details 프레임마다 재사용하며, 부족할 때만 2배씩 늘립니다.
+     */
+    char*  _out_buf;
+    size_t _out_cap;   /**< _out_buf 크기 (bytes) */
+    size_t _out_limit; /**< 출력 버퍼 최대 크기 (0 = 무제한) */
+    cc_sink_t* _sink;  /**< flush 출력을 받을 곳 (NULL = 표준 출력, 소유하지 않음) */
+
+    cc_color_mode_e _color_mode; /**< 출력 색상 모드 (기본값: TRUECOLOR) */
+    uint32_t        _term_caps;  /**< 사용할 터미널 기능 (CC_TERM_CAP_*) */
+
+    struct cc_flush_pool_s* _flush_pool; /**< 병렬 flush 스레드 풀 (NULL = 단일 스레드) */
+    struct cc_writer_s*     _writer;     /**< 비동기 출력 스레드 (NULL = flush가 직접 출력) */
 } cc_buffer_t;
 
+/**
+ * @brief 버퍼의 일부 영역에 그리기 위한 가벼운 뷰 (값 타입, 해제 불필요)
+ * @details 뷰 함수의 좌표는 _origin 기준이며, _clip (버퍼 좌표계) 밖은 그리지 않습니다.
+ * 위젯은 자신의 창 크기만 알면 되고, 넘치는 문자열을 직접 자를 필요가 없습니다.
+ */
+typedef struct
+{
+    cc_buffer_t* _buffer;   /**< 대상 버퍼 */
+    int          _origin_x; /**< 뷰 (0, 0)의 버퍼 X 좌표 */
+    int          _origin_y; /**< 뷰 (0, 0)의 버퍼 Y 좌표 */
+    cc_rect_t    _clip;     /**< 그릴 수 있는 영역 (버퍼 좌표계) */
+} cc_buffer_view_t;
+
 // -----------------------------------------------------------------------------
 // Function Prototypes
 // -----------------------------------------------------------------------------
@@ -65,6 +183,10 @@ void cc_buffer_destroy( cc_buffer_t* self );
 
 /**
  * @brief 버퍼 크기를 조절합니다. (화면 리사이즈 시 호출)
+ * @details 겹치는 영역의 내용은 유지하고, 새로 드러난 영역만 공백(검정 배경)으로 채웁니다.
+ * 줄어들 때는 기존 메모리를 재사용합니다. CC_TERM_CAP_RESIZE_KEEP 이 켜져 있으면
+ * 터미널도 겹치는 영역을 유지한다고 보고 다음 flush에서 새 영역만 출력하며,
+ * 꺼져 있으면(기본값) 화면 전체를 다시 출력합니다.
  * @param self 대상 객체
  * @param width 변경할 너비
  * @param height 변경할 높이
@@ -74,13 +196,25 @@ bool cc_buffer_resize( cc_buffer_t* self, int width, int height );
 
 /**
  * @brief Back Buffer를 특정 배경색으로 초기화합니다. (매 프레임 시작 시 호출)
+ * @details 모든 행이 변경(Dirty)으로 기록됩니다. Clip 영역과 관계없이 버퍼 전체를 채웁니다.
  * @param self 대상 객체
  * @param bg_color 채울 배경색
  */
 void cc_buffer_clear( cc_buffer_t* self, const cc_color_t* bg_color );
 
+/**
+ * @brief Back Buffer의 사각 영역만 특정 배경색으로 초기화합니다. (부분 갱신용)
+ * @details 영역 안의 행만 변경(Dirty)으로 기록됩니다. 영역 경계에 걸친 2칸 문자는 공백으로 바뀝니다.
+ * @param self 대상 객체
+ * @param rect 초기화할 영역 (버퍼/Clip 밖 부분은 잘라냄)
+ * @param bg_color 채울 배경색 (NULL = 검정)
+ */
+void cc_buffer_clear_rect( cc_buffer_t* self, const cc_rect_t* rect, const cc_color_t* bg_color );
+
 /**
  * @brief 문자열을 특정 좌표에 그립니다.
+ * @details Clip 영역 밖의 행이면 바로 반환하고, 왼쪽 밖의 글자는 기록 없이 건너뛰며,
+ * 오른쪽 경계에 닿으면 나머지 문자열을 읽지 않습니다.
  * @param self 대상 객체
  * @param x X 좌표
  * @param y Y 좌표
@@ -103,10 +237,260 @@ void cc_buffer_draw_string( cc_buffer_t* self, int x, int y, const char* text, c
  */
 void cc_buffer_draw_box( cc_buffer_t* self, int x, int y, int w, int h, const cc_color_t* fg, const cc_color_t* bg, bool red_border );
 
+/**
+ * @brief 사각 영역을 같은 셀로 채웁니다. (문자열 해석 없이 행 단위로 채움)
+ * @details 2칸 문자나 Trail 셀은 채울 수 없으므로 공백으로 바뀝니다. 영역 경계에 걸친 기존 2칸 문자는 공백으로 정리합니다.
+ * @param self 대상 객체
+ * @param rect 채울 영역 (버퍼/Clip 밖 부분은 잘라냄)
+ * @param cell 채울 셀 (cc_cell_init 으로 생성)
+ */
+void cc_buffer_fill_rect( cc_buffer_t* self, const cc_rect_t* rect, const cc_cell_t* cell );
+
+/**
+ * @brief 테두리 모양과 그림자를 지정하여 박스를 그립니다.
+ * @details 테두리와 내부를 변(행/열) 단위로 채우므로 셀마다 문자열을 해석하지 않습니다.
+ * 그림자는 박스 오른쪽 2칸과 아래 1행(오른쪽으로 2칸 밀림)의 배경색만 바꾸고 글자는 그대로 둡니다.
+ * @param self 대상 객체
+ * @param rect 박스 영역
+ * @param style 테두리 모양
+ * @param fg 선 색상 (NULL = 흰색)
+ * @param bg 배경색 (NULL = 검정)
+ * @param shadow 그림자 배경색 (NULL = 그림자 없음)
+ */
+void cc_buffer_draw_box_style( cc_buffer_t* self, const cc_rect_t* rect, cc_box_style_e style, const cc_color_t* fg, const cc_color_t* bg, const cc_color_t* shadow );
+
+/**
+ * @brief 셀 하나를 만듭니다. (cc_buffer_write_cells 등에 넘길 셀을 미리 만들 때 사용)
+ * @param cell [Output] 결과 셀
+ * @param glyph 글리프 ID (코드포인트 또는 cc_glyph_decode 결과, 2칸 문자의 Trail은 CC_CELL_FLAG_WIDE_TRAIL << CC_CELL_FLAG_SHIFT)
+ * @param fg 글자색 (NULL = 흰색)
+ * @param bg 배경색 (NULL = 검정)
+ */
+void cc_cell_init( cc_cell_t* cell, uint32_t glyph, const cc_color_t* fg, const cc_color_t* bg );
+
+/**
+ * @brief 미리 만든 셀 count개를 (x, y)부터 그대로 복사합니다. (UTF-8 디코딩/너비 계산 없음)
+ * @details 2칸 문자는 Lead 셀 다음에 Trail 셀(CC_CELL_FLAG_WIDE_TRAIL)이 있어야 합니다.
+ * Clip 영역 밖은 잘라내고, 잘려서 짝을 잃은 2칸 문자와 덮어쓴 영역 경계에 걸친 기존 2칸 문자는 공백으로 바뀝니다.
+ * @param self 대상 객체
+ * @param x 시작 X 좌표
+ * @param y Y 좌표
+ * @param cells 복사할 셀 배열
+ * @param count 셀 개수
+ */
+void cc_buffer_write_cells( cc_buffer_t* self, int x, int y, const cc_cell_t* cells, int count );
+
+/**
+ * @brief 다른 버퍼(또는 같은 버퍼)의 사각 영역을 (x, y)에 행 단위로 복사합니다.
+ * @details 글자를 다시 해석하지 않고 셀을 그대로 복사하므로 미리 그려 둔 캔버스/이미지를 메모리 복사 속도로 옮깁니다.
+ * 원본의 Back Buffer를 읽으며 원본 Clip은 무시합니다. 경계에서 짝을 잃은 2칸 문자는 cc_buffer_write_cells 와 같이 공백으로 바뀝니다.
+ * @param self 대상 객체
+ * @param x 대상 X 좌표
+ * @param y 대상 Y 좌표
+ * @param src 원본 버퍼 (self 와 같아도 되며 영역이 겹쳐도 됨)
+ * @param src_rect 복사할 원본 영역 (NULL = 원본 전체)
+ */
+void cc_buffer_blit( cc_buffer_t* self, int x, int y, const cc_buffer_t* src, const cc_rect_t* src_rect );
+
+/**
+ * @brief 이후 draw 함수가 그릴 수 있는 영역을 rect 로 제한합니다. (현재 영역과의 교집합)
+ * @details cc_buffer_pop_clip 으로 이전 영역으로 되돌립니다. cc_buffer_clear 와 scroll_region 은 영향을 받지 않습니다.
+ * @param self 대상 객체
+ * @param rect 제한할 영역 (버퍼 좌표계)
+ * @return 성공 여부 (스택이 가득 차면 false, 이때는 pop 하지 않아야 함)
+ */
+bool cc_buffer_push_clip( cc_buffer_t* self, const cc_rect_t* rect );
+
+/**
+ * @brief 마지막으로 push 한 Clip 영역을 해제합니다.
+ * @param self 대상 객체
+ */
+void cc_buffer_pop_clip( cc_buffer_t* self );
+
+/**
+ * @brief 현재 그릴 수 있는 영역 (Clip과 버퍼 범위의 교집합)을 반환합니다.
+ * @param self 대상 객체
+ */
+cc_rect_t cc_buffer_get_clip( const cc_buffer_t* self );
+
+/**
+ * @brief 버퍼의 사각 영역에 대한 뷰를 만듭니다.
+ * @details 뷰의 Clip은 rect 와 생성 시점의 버퍼 Clip의 교집합입니다.
+ * @param self 대상 버퍼
+ * @param rect 뷰 영역 (버퍼 좌표계, NULL = 버퍼 전체)
+ * @return 뷰 (self 가 NULL이면 아무것도 그리지 않는 빈 뷰)
+ */
+cc_buffer_view_t cc_buffer_view_make( cc_buffer_t* self, const cc_rect_t* rect );
+
+/**
+ * @brief 뷰 안의 사각 영역에 대한 하위 뷰를 만듭니다. (Clip은 부모 Clip과의 교집합)
+ * @param parent 부모 뷰
+ * @param rect 하위 뷰 영역 (부모 뷰 좌표계)
+ */
+cc_buffer_view_t cc_buffer_view_sub( const cc_buffer_view_t* parent, const cc_rect_t* rect );
+
+/**
+ * @brief 뷰 좌표 (x, y)에 문자열을 그립니다. (cc_buffer_draw_string 과 같으나 뷰 Clip으로 제한)
+ */
+void cc_buffer_view_draw_string( const cc_buffer_view_t* view, int x, int y, const char* text, const cc_color_t* fg, const cc_color_t* bg );
+
+/**
+ * @brief 뷰 좌표의 사각 영역을 배경색으로 초기화합니다. (rect = NULL 이면 뷰 전체)
+ */
+void cc_buffer_view_clear_rect( const cc_buffer_view_t* view, const cc_rect_t* rect, const cc_color_t* bg_color );
+
+/**
+ * @brief 뷰 좌표 (x, y)에 셀 배열을 복사합니다. (cc_buffer_write_cells 와 같으나 뷰 Clip으로 제한)
+ */
+void cc_buffer_view_write_cells( const cc_buffer_view_t* view, int x, int y, const cc_cell_t* cells, int count );
+
+/**
+ * @brief 뷰 좌표 (x, y)에 원본 버퍼의 영역을 복사합니다. (cc_buffer_blit 과 같으나 뷰 Clip으로 제한)
+ */
+void cc_buffer_view_blit( const cc_buffer_view_t* view, int x, int y, const cc_buffer_t* src, const cc_rect_t* src_rect );
+
+/**
+ * @brief 뷰 좌표에 박스를 그립니다. (cc_buffer_draw_box 와 같으나 뷰 Clip으로 제한)
+ */
+void cc_buffer_view_draw_box( const cc_buffer_view_t* view, int x, int y, int w, int h, const cc_color_t* fg, const cc_color_t* bg, bool red_border );
+
+/**
+ * @brief 뷰 좌표의 사각 영역을 같은 셀로 채웁니다. (cc_buffer_fill_rect 와 같으나 뷰 Clip으로 제한)
+ */
+void cc_buffer_view_fill_rect( const cc_buffer_view_t* view, const cc_rect_t* rect, const cc_cell_t* cell );
+
+/**
+ * @brief 뷰 좌표에 박스를 그립니다. (cc_buffer_draw_box_style 과 같으나 뷰 Clip으로 제한)
+ */
+void cc_buffer_view_draw_box_style( const cc_buffer_view_t* view, const cc_rect_t* rect, cc_box_style_e style, const cc_color_t* fg, const cc_color_t* bg, const cc_color_t* shadow );
+
+/**
+ * @brief 영역의 내용을 세로로 dy행 이동합니다. (로그 창, 목록 스크롤 등)
+ * @details 영역이 버퍼 전체 너비이면 Front Buffer도 함께 옮기고, 다음 flush에서
+ * 스크롤 영역 지정(DECSTBM) + SU/SD 시퀀스 하나로 터미널 화면을 이동시킵니다.
+ * 따라서 새로 드러난 행만 다시 그리면 됩니다.
+ * 일부 너비 영역은 터미널이 좌우 범위 스크롤을 지원하지 않으므로 Back Buffer만 옮깁니다.
+ * 새로 드러난 칸은 공백(검정 배경)으로 채워집니다.
+ * @param self 대상 객체
+ * @param rect 이동할 영역 (버퍼 밖 부분은 잘라냄)
+ * @param dy 이동량 (음수 = 위로, 양수 = 아래로)
+ */
+void cc_buffer_scroll_region( cc_buffer_t* self, const cc_rect_t* rect, int dy );
+
+/**
+ * @brief flush 시 행 이동(스크롤) 자동 감지를 켜거나 끕니다.
+ * @details 켜면 flush가 Back의 행들이 Front의 행들을 k행 옮긴 것과 같은지 행 해시로 찾아,
+ * 다시 그리는 대신 스크롤 시퀀스를 보냅니다. 매 flush마다 행 해시를 계산하므로 기본값은 꺼짐입니다.
+ * @param self 대상 객체
+ * @param enable 사용 여부
+ */
+void cc_buffer_set_scroll_detect( cc_buffer_t* self, bool enable );
+
+/**
+ * @brief flush 출력 버퍼의 최대 크기를 설정합니다.
+ * @details 한 프레임의 출력이 이 크기를 넘으면 버퍼를 늘리지 않고 중간까지 먼저 출력한 뒤
+ * 이어서 인코딩합니다. (거대한 터미널의 전체 갱신도 최악의 크기를 할당하지 않음)
+ * @param self 대상 객체
+ * @param max_bytes 최대 크기 (0 = 무제한, 기본값)
+ */
+void cc_buffer_set_output_limit( cc_buffer_t* self, size_t max_bytes );
+
+/**
+ * @brief flush 시 사용할 출력 색상 모드를 설정합니다.
+ * @details 256/16색 모드에서는 RGB 색을 가장 가까운 팔레트 색으로 바꿔 출력하므로
+ * 색상 시퀀스가 짧아지고, TrueColor를 지원하지 않는 터미널에서도 색이 표시됩니다.
+ * 모드가 바뀌면 다음 flush에서 화면 전체를 다시 출력합니다.
+ * @param self 대상 객체
+ * @param mode 출력 색상 모드
+ */
+void cc_buffer_set_color_mode( cc_buffer_t* self, cc_color_mode_e mode );
+
+/**
+ * @brief flush가 사용할 터미널 기능을 설정합니다.
+ * @details 같은 배경색의 공백 구간은 ECH/EL로, 같은 문자의 반복은 REP로 압축하여 출력합니다.
+ * 해당 시퀀스를 지원하지 않는 터미널에서는 플래그를 빼면 됩니다.
+ * @param self 대상 객체
+ * @param caps CC_TERM_CAP_* 조합 (기본값: CC_TERM_CAPS_DEFAULT)
+ */
+void cc_buffer_set_term_caps( cc_buffer_t* self, uint32_t caps );
+
+/**
+ * @brief flush를 여러 스레드로 나눠 인코딩하도록 설정합니다. (대형 화면 전체 갱신용)
+ * @details 변경된 행이 충분히 많은 프레임에서 행 묶음(Band)별로 비교/인코딩한 뒤
+ * 순서대로 이어 붙여 한 번에 출력합니다. 작은 변경은 기존처럼 단일 스레드로 처리합니다.
+ * @param self 대상 객체
+ * @param threads 사용할 스레드 수 (flush를 호출한 스레드 포함, 1 이하 = 끔)
+ * @return 성공 여부 (스레드 생성 실패 시 false, 단일 스레드로 동작)
+ */
+bool cc_buffer_set_flush_threads( cc_buffer_t* self, int threads );
+
+/**
+ * @brief flush 출력을 받을 곳(Sink)을 지정합니다.
+ * @details Sink는 소유하지 않으므로 버퍼가 사용하는 동안 살아 있어야 합니다.
+ * 새 출력 대상은 지금까지의 화면을 모르므로 다음 flush는 화면 전체를 출력합니다.
+ * 비동기 출력 중이면 기다리지 않고 바꾸며, 아직 보내지 않은 프레임은 버리고
+ * 이미 전송 중인 프레임만 이전 Sink로 마저 보냅니다. (이전 Sink를 해제하기 전에는 cc_buffer_wait_output 호출)
+ * @param self 대상 객체
+ * @param sink 출력 Sink (NULL = 표준 출력)
+ * @return 성공 여부 (비동기 출력 중 터미널을 다시 열지 못하면 false, 이전 Sink 유지)
+ */
+bool cc_buffer_set_sink( cc_buffer_t* self, cc_sink_t* sink );
+
+/**
+ * @brief flush 출력을 별도 스레드에서 전송하도록 설정합니다. (느린 터미널/원격 접속용)
+ * @details 켜면 flush는 인코딩한 프레임을 출력 스레드에 넘기고 바로 반환하므로
+ * 터미널 출력이 밀려도 UI 스레드(입력 처리 포함)가 멈추지 않습니다.
+ * 출력 스레드는 터미널을 Non-blocking으로 따로 열어 사용합니다. (Sink가 지정되어 있으면 그 Sink에 씀)
+ * 이전 프레임이 아직 전송 중일 때 여러 프레임이 쌓이면 마지막 프레임만 남기고 버리며,
+ * 버린 프레임이 그린 범위는 다음 프레임에서 다시 비교하여 화면이 어긋나지 않게 합니다.
+ * 출력 버퍼 최대 크기(cc_buffer_set_output_limit)는 적용되지 않습니다.
+ * @param self 대상 객체
+ * @param enable 사용 여부 (끌 때는 남은 프레임을 전송한 뒤 스레드를 종료,
+ *               터미널이 출력을 받지 않아 잠시 안에 끝나지 않으면 남은 프레임은 버림)
+ * @return 성공 여부 (스레드 생성 실패 시 false, flush가 직접 출력)
+ */
+bool cc_buffer_set_async_output( cc_buffer_t* self, bool enable );
+
+/**
+ * @brief 비동기 출력 중인 프레임이 모두 터미널로 전송될 때까지 기다립니다.
+ * @details 프레임 전송 중에 printf 등으로 직접 출력하면 시퀀스가 섞일 수 있으므로
+ * 그 전에 호출합니다. 비동기 출력을 사용하지 않으면 바로 반환합니다.
+ * @param self 대상 객체
+ */
+void cc_buffer_wait_output( cc_buffer_t* self );
+
+/**
+ * @brief 영역을 변경됨으로 표시합니다.
+ * @details 다음 flush 에서 이 영역을 Front Buffer와 비교하고, cc_buffer_get_damage 결과에도 포함됩니다.
+ * draw 함수를 거치지 않고 _back_buffer 를 직접 고쳤을 때나, 앱이 다시 그려야 할 영역(창 이동 전/후 위치 등)을
+ * 알릴 때 사용합니다. Clip은 적용하지 않습니다.
+ * @param self 대상 객체
+ * @param rect 변경된 영역 (버퍼 밖 부분은 잘라냄)
+ */
+void cc_buffer_damage( cc_buffer_t* self, const cc_rect_t* rect );
+
+/**
+ * @brief 마지막 flush 이후 변경된 영역을 겹치지 않는 사각형 몇 개로 합쳐 반환합니다.
+ * @details 결과는 앱이 다시 그릴 영역을 고르는 데 쓰는 참고용 출력일 뿐이며, flush 는 이 사각형을 쓰지 않고
+ * 행별 변경 범위(Dirty Span)를 그대로 비교합니다. 합치는 비용은 이 함수를 호출할 때만 들고 flush 에는 들지 않습니다.
+ * 행별 변경 범위 중 위아래로 붙어 있고 열이 겹치는 것을 한 사각형으로 묶고, max_rects 를 넘으면
+ * 새로 생긴 사각형을 합쳤을 때 늘어나는 면적이 가장 작은 사각형에 합칩니다. (변경 행마다 O(max_rects))
+ * 결과는 실제 변경 범위를 모두 덮지만 최소 면적은 아닙니다. (증분 다시 그리기, cc_displaylist_replay 의 area 등에 사용)
+ * @param self 대상 객체
+ * @param out_rects [Output] 결과 사각형 배열 (max_rects 개 이상)
+ * @param max_rects 최대 사각형 수 (CC_DAMAGE_RECTS_MAX 보다 크면 CC_DAMAGE_RECTS_MAX)
+ * @return 사각형 수 (변경이 없으면 0)
+ */
+int cc_buffer_get_damage( const cc_buffer_t* self, cc_rect_t* out_rects, int max_rects );
+
 /**
  * @brief [핵심] 변경된 부분(Diff)만 계산하여 터미널로 출력합니다.
  * @details Back Buffer와 Front Buffer를 비교하여 달라진 부분만 ANSI 코드로 출력하고,
  * Front Buffer를 Back Buffer 상태로 동기화합니다.
+ * 마지막 flush 이후 draw/clear 함수가 기록한 변경 범위(Dirty Span)만 비교하므로
+ * 비용은 화면 크기가 아니라 변경된 셀 수에 비례합니다.
+ * 프레임은 write()로 끊김 없이 전송되며, CC_TERM_CAP_SYNC 가 켜져 있으면
+ * 동기화 출력 시퀀스로 감싸 터미널이 반쯤 그려진 화면을 표시하지 않게 합니다.
  * @param self 대상 객체
  */
 void cc_buffer_flush( cc_buffer_t* self );
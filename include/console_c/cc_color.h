@@ -28,6 +28,16 @@ typedef enum
     CC_COLOR_TYPE_RESET = 2
 } cc_color_type_e;
 
+/**
+ * @brief 터미널 출력 색상 모드 (터미널이 지원하는 색 깊이)
+ */
+typedef enum
+{
+    CC_COLOR_MODE_TRUECOLOR = 0, /**< 24비트 RGB (\033[38;2;R;G;Bm) */
+    CC_COLOR_MODE_256       = 1, /**< xterm 256색 팔레트 (\033[38;5;Nm) */
+    CC_COLOR_MODE_16        = 2  /**< 기본 16색 (\033[3Xm / \033[9Xm) */
+} cc_color_mode_e;
+
 /**
  * @brief RGB 값을 담는 단순 구조체
  */
@@ -60,6 +70,7 @@ extern const cc_color_t CC_COLOR_CYAN;
 extern const cc_color_t CC_COLOR_MAGENTA;
 extern const cc_color_t CC_COLOR_GRAY;
 extern const cc_color_t CC_COLOR_RESET; /**< 터미널 색상 초기화 (\033[0m) */
+extern const cc_color_t CC_COLOR_NONE;  /**< 투명 (cc_layer 합성 시 아래 레이어의 색이 보임) */
 
 // -----------------------------------------------------------------------------
 // Function Prototypes
@@ -116,6 +127,17 @@ const char* cc_color_to_ansi_bg( const cc_color_t* self, char* buf, size_t buf_l
  */
 const char* cc_color_to_hex( const cc_color_t* self, char* buf, size_t buf_len );
 
+/**
+ * @brief RGB 값을 지정한 모드의 팔레트에서 가장 가까운 색 인덱스로 변환합니다.
+ * @details 지각 거리(Redmean)로 가장 가까운 색을 찾으며, 결과는 색상별로 캐싱됩니다. (스레드 안전)
+ * - CC_COLOR_MODE_256 : 16~255 (테마에 따라 바뀌는 0~15는 사용하지 않음)
+ * - CC_COLOR_MODE_16  : 0~15
+ * @param rgb 변환할 RGB 값
+ * @param mode 대상 색상 모드 (TRUECOLOR는 의미가 없으므로 0 반환)
+ * @return 팔레트 인덱스
+ */
+uint8_t cc_color_quantize( const cc_rgb_t* rgb, cc_color_mode_e mode );
+
 /**
  * @brief 두 색상 객체가 동일한지 비교합니다.
  */
@@ -30,6 +30,7 @@ typedef enum
     CC_KEY_MOUSE_EVENT  = 2000, /**< 마우스 동작 */
     CC_KEY_RESIZE_EVENT = 3000, /**< 터미널 크기 변경 (SIGWINCH) */
     CC_KEY_CURSOR_EVENT = 4000, /**< 커서 위치 응답 (내부 처리용) */
+    CC_KEY_MODE_EVENT   = 4001, /**< 모드 상태 응답 (내부 처리용) */
 
     // --- Standard Keys ---
     CC_KEY_TAB       = 9,
@@ -68,6 +69,18 @@ typedef enum
 
 } cc_key_code_e;
 
+/**
+ * @brief 터미널 모드 상태 (DECRQM 응답값)
+ */
+typedef enum
+{
+    CC_MODE_STATE_UNKNOWN         = 0, /**< 터미널이 모르는 모드 (미지원) */
+    CC_MODE_STATE_SET             = 1, /**< 켜짐 */
+    CC_MODE_STATE_RESET           = 2, /**< 꺼짐 (지원함) */
+    CC_MODE_STATE_PERMANENT_SET   = 3, /**< 항상 켜짐 */
+    CC_MODE_STATE_PERMANENT_RESET = 4  /**< 항상 꺼짐 (사실상 미지원) */
+} cc_mode_state_e;
+
 typedef enum { CC_MOUSE_BTN_LEFT, CC_MOUSE_BTN_MIDDLE, CC_MOUSE_BTN_RIGHT, CC_MOUSE_BTN_UNKNOWN } cc_mouse_btn_e;
 typedef enum { CC_MOUSE_ACTION_PRESS, CC_MOUSE_ACTION_DRAG, CC_MOUSE_ACTION_RELEASE, CC_MOUSE_ACTION_WHEEL_UP, CC_MOUSE_ACTION_WHEEL_DOWN, CC_MOUSE_ACTION_UNKNOWN } cc_mouse_action_e;
 
@@ -116,6 +129,9 @@ void cc_device_deinit( void );
 
 /**
  * @brief [Blocking] 지정된 시간(ms) 동안 입력을 대기합니다.
+ * @details timeout_ms = 0 이면 기다리지 않고 표준 입력을 한 번 확인하여(timeout 0 select)
+ * 이미 도착한 입력이 있으면 읽어서 반환합니다. (쌓인 입력을 한 번에 비울 때 사용)
+ * 이전에는 내부 버퍼에 남은 바이트만 해석하고 표준 입력은 읽지 않고 반환했습니다.
  * @param timeout_ms 대기 시간 (음수: 무한 대기, 0: Non-blocking, 양수: 밀리초)
  * @return 입력 코드 (타임아웃 시 CC_KEY_NONE)
  */
@@ -136,6 +152,21 @@ void cc_device_inspect( cc_key_code_e key_code, cc_input_event_t* out_event );
  */
 bool cc_device_get_cursor_pos( int timeout_ms, cc_coord_t* out_coord );
 
+/**
+ * @brief [Thread-Safe] DEC Private 모드의 상태를 터미널에 질의합니다. (DECRQM)
+ * @details 예: 동기화 출력(2026) 지원 확인 후 cc_buffer_set_term_caps 에 CC_TERM_CAP_SYNC 추가
+ * @code
+ * cc_mode_state_e state;
+ * if( cc_device_query_mode( 2026, 100, &state ) &&
+ *     ( state == CC_MODE_STATE_SET || state == CC_MODE_STATE_RESET ) ){ ... }
+ * @endcode
+ * @param mode 모드 번호 (예: 2026)
+ * @param timeout_ms 타임아웃 시간 (DECRQM을 모르는 터미널은 응답하지 않음)
+ * @param out_state [Output] 모드 상태
+ * @return 응답 수신 여부 (false: 타임아웃 혹은 실패)
+ */
+bool cc_device_query_mode( int mode, int timeout_ms, cc_mode_state_e* out_state );
+
 /**
  * @brief 마우스 추적 모드를 활성화/비활성화합니다.
  */
@@ -0,0 +1,134 @@
+#ifndef _CONSOLE_C_DISPLAYLIST_H_
+#define _CONSOLE_C_DISPLAYLIST_H_
+
+/** ------------------------------------------------------------------------------------
+ * ConsoleC Display List Module Header
+ * ------------------------------------------------------------------------------------
+ * 그리기 명령(문자열, 박스, 채우기, 블릿)을 영역(Bounds)과 함께 한 번 기록해 두고,
+ * 필요할 때 버퍼에 다시 재생(Replay)합니다.
+ * 메뉴 바, 창 테두리, 라벨처럼 거의 바뀌지 않는 화면 요소는 매 프레임 문자열을 만들고
+ * 그리는 대신 한 번 기록한 뒤 재생만 하고, 다시 그릴 영역과 겹치지 않는 명령은 건너뜁니다.
+ *
+ * 사용 예:
+ *   cc_displaylist_t* chrome = cc_displaylist_create();
+ *   cc_displaylist_draw_box( chrome, &win, CC_BOX_STYLE_HEAVY, &CC_COLOR_WHITE, &CC_COLOR_BLACK, NULL );
+ *   cc_displaylist_draw_string( chrome, 2, 0, "Title", &CC_COLOR_YELLOW, &CC_COLOR_BLACK );
+ *   ...
+ *   cc_displaylist_replay( chrome, buffer, NULL );      // 전체 재생
+ *   cc_displaylist_replay( chrome, buffer, &damaged );  // 영역 안만 재생
+ * ------------------------------------------------------------------------------------ */
+
+#include "console_c/cc_buffer.h"
+#include <stdbool.h>
+
+// -----------------------------------------------------------------------------
+// Data Structures
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief 기록된 명령 종류
+ */
+typedef enum
+{
+    CC_DL_OP_STRING = 0, /**< cc_buffer_draw_string */
+    CC_DL_OP_BOX    = 1, /**< cc_buffer_draw_box_style */
+    CC_DL_OP_FILL   = 2, /**< cc_buffer_fill_rect */
+    CC_DL_OP_BLIT   = 3  /**< cc_buffer_blit */
+} cc_dl_op_e;
+
+/**
+ * @brief 기록된 그리기 명령 하나
+ * @details 색상은 기록 시점에 기본값(NULL)을 풀어서 저장합니다.
+ */
+typedef struct
+{
+    cc_dl_op_e         _op;
+    cc_rect_t          _bounds;     /**< 명령이 그릴 수 있는 영역 (버퍼 좌표계, 컬링용) */
+    cc_rect_t          _rect;       /**< BOX/FILL 영역, BLIT 원본 영역 */
+    int                _x;          /**< STRING/BLIT 시작 좌표 */
+    int                _y;
+    size_t             _text;       /**< STRING: 문자열 풀(_text_pool) 내 위치 */
+    cc_color_t         _fg;
+    cc_color_t         _bg;
+    cc_color_t         _shadow;     /**< BOX: 그림자 배경색 */
+    bool               _has_shadow;
+    cc_box_style_e     _style;      /**< BOX: 테두리 모양 */
+    cc_cell_t          _cell;       /**< FILL: 채울 셀 */
+    const cc_buffer_t* _src;        /**< BLIT: 원본 버퍼 (재생 시점의 내용을 복사, 소유하지 않음) */
+} cc_dl_cmd_t;
+
+/**
+ * @brief 디스플레이 리스트
+ */
+typedef struct
+{
+    cc_dl_cmd_t* _cmds;
+    int          _count;
+    int          _cap;
+
+    char*        _text_pool;    /**< STRING 명령의 문자열 (NULL 종료, 이어 붙여 저장) */
+    size_t       _text_len;
+    size_t       _text_cap;
+
+    cc_rect_t    _bounds;       /**< 모든 명령 영역을 감싸는 사각형 (명령이 없으면 빈 영역) */
+} cc_displaylist_t;
+
+// -----------------------------------------------------------------------------
+// Function Prototypes
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief 빈 디스플레이 리스트를 생성합니다.
+ * @return 생성된 객체 (실패 시 NULL)
+ */
+cc_displaylist_t* cc_displaylist_create( void );
+
+/**
+ * @brief 디스플레이 리스트를 해제합니다.
+ * @param self 대상 객체
+ */
+void cc_displaylist_destroy( cc_displaylist_t* self );
+
+/**
+ * @brief 기록된 명령을 모두 지웁니다. (할당된 메모리는 다시 기록할 때 재사용)
+ * @param self 대상 객체
+ */
+void cc_displaylist_clear( cc_displaylist_t* self );
+
+/**
+ * @brief 문자열 그리기를 기록합니다. (인자는 cc_buffer_draw_string 과 같음, text는 복사)
+ * @return 성공 여부
+ */
+bool cc_displaylist_draw_string( cc_displaylist_t* self, int x, int y, const char* text, const cc_color_t* fg, const cc_color_t* bg );
+
+/**
+ * @brief 박스 그리기를 기록합니다. (인자는 cc_buffer_draw_box_style 과 같음)
+ * @return 성공 여부
+ */
+bool cc_displaylist_draw_box( cc_displaylist_t* self, const cc_rect_t* rect, cc_box_style_e style, const cc_color_t* fg, const cc_color_t* bg, const cc_color_t* shadow );
+
+/**
+ * @brief 사각 영역 채우기를 기록합니다. (인자는 cc_buffer_fill_rect 와 같음)
+ * @return 성공 여부
+ */
+bool cc_displaylist_fill_rect( cc_displaylist_t* self, const cc_rect_t* rect, const cc_cell_t* cell );
+
+/**
+ * @brief 다른 버퍼의 영역 복사를 기록합니다. (인자는 cc_buffer_blit 과 같음)
+ * @details src 는 복사하지 않으므로 리스트를 재생하는 동안 살아 있어야 하며, 재생 시점의 내용이 복사됩니다.
+ * @return 성공 여부
+ */
+bool cc_displaylist_blit( cc_displaylist_t* self, int x, int y, const cc_buffer_t* src, const cc_rect_t* src_rect );
+
+/**
+ * @brief 기록된 명령을 순서대로 버퍼에 재생합니다.
+ * @details area 와 겹치지 않는 명령은 건너뛰고, 겹치는 명령도 area 안에만 그립니다. (버퍼의 현재 Clip도 적용)
+ * Clip 스택이 가득 차(CC_CLIP_STACK_MAX) area 를 걸 수 없으면 area 밖을 건드리지 않도록
+ * area 안에 완전히 들어가는 명령만 그리고 걸치는 명령은 건너뜁니다.
+ * @param self 대상 객체
+ * @param target 그릴 버퍼
+ * @param area 다시 그릴 영역 (NULL = 버퍼 전체)
+ */
+void cc_displaylist_replay( const cc_displaylist_t* self, cc_buffer_t* target, const cc_rect_t* area );
+
+#endif // _CONSOLE_C_DISPLAYLIST_H_
\ No newline at end of file
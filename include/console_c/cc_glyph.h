@@ -0,0 +1,71 @@
+#ifndef _CONSOLE_C_GLYPH_H_
+#define _CONSOLE_C_GLYPH_H_
+
+/** ------------------------------------------------------------------------------------
+ * ConsoleC Glyph Module Header
+ * ------------------------------------------------------------------------------------
+ * 셀에 저장되는 32비트 글리프 ID를 관리합니다.
+ * 코드포인트 하나로 된 글자는 코드포인트 값을 그대로 ID로 쓰고,
+ * 여러 코드포인트로 된 글자(결합 문자, ZWJ 이모지, 국기 등)는 전역 표에 등록(Intern)하여
+ * CC_GLYPH_CLUSTER_BASE 이상의 ID를 부여합니다. 같은 글자는 항상 같은 ID를 가지므로
+ * 셀 비교는 정수 비교 한 번으로 끝나고, 너비와 UTF-8 바이트는 등록 시 한 번만 계산합니다.
+ * ------------------------------------------------------------------------------------ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// -----------------------------------------------------------------------------
+// Constants
+// -----------------------------------------------------------------------------
+
+#define CC_GLYPH_CLUSTER_BASE 0x110000u /**< 등록된 글자 ID 시작 값 (유니코드 범위 바로 다음) */
+#define CC_GLYPH_MAX_BYTES    32        /**< 글자 하나의 최대 UTF-8 길이 (넘는 결합 문자는 버림) */
+#define CC_GLYPH_REPLACEMENT  0xFFFDu   /**< 잘못된 시퀀스/등록 실패 시 사용하는 대체 문자 */
+
+#define CC_GLYPH_IS_CLUSTER( _glyph ) ( ( _glyph ) >= CC_GLYPH_CLUSTER_BASE )
+
+// -----------------------------------------------------------------------------
+// Function Prototypes
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief UTF-8 문자열에서 첫 글자를 읽어 글리프 ID로 변환합니다.
+ * @details 여러 코드포인트로 된 글자는 전역 표에 등록합니다. (스레드 안전)
+ * 잘못된 시퀀스는 CC_GLYPH_REPLACEMENT 로 바꿉니다.
+ * @param text UTF-8 문자열 (NULL 종료)
+ * @param out_glyph [Output] 글리프 ID
+ * @return 소비한 바이트 수 (문자열 끝이면 0)
+ */
+int cc_glyph_decode( const char* text, uint32_t* out_glyph );
+
+/**
+ * @brief UTF-8 바이트열 하나(글자 하나)를 글리프 ID로 등록합니다.
+ * @param utf8 글자의 UTF-8 바이트
+ * @param len 바이트 수
+ * @return 글리프 ID (코드포인트 하나면 코드포인트, 등록 실패 시 CC_GLYPH_REPLACEMENT)
+ */
+uint32_t cc_glyph_intern( const char* utf8, size_t len );
+
+/**
+ * @brief 글리프의 출력 너비를 반환합니다.
+ * @param glyph 글리프 ID
+ * @return 0 (결합 문자 단독), 1, 2
+ */
+int cc_glyph_width( uint32_t glyph );
+
+/**
+ * @brief 글리프의 UTF-8 바이트를 기록합니다.
+ * @param glyph 글리프 ID
+ * @param out_buf [Output] 결과 버퍼 (최소 CC_GLYPH_MAX_BYTES, NULL 종료하지 않음)
+ * @return 작성된 바이트 수
+ */
+int cc_glyph_encode( uint32_t glyph, char* out_buf );
+
+/**
+ * @brief 글리프의 UTF-8 바이트 수를 반환합니다.
+ * @param glyph 글리프 ID
+ */
+int cc_glyph_byte_length( uint32_t glyph );
+
+#endif // _CONSOLE_C_GLYPH_H_
\ No newline at end of file
@@ -0,0 +1,138 @@
+#ifndef _CONSOLE_C_LAYER_H_
+#define _CONSOLE_C_LAYER_H_
+
+/** ------------------------------------------------------------------------------------
+ * ConsoleC Layer Compositor Module Header
+ * ------------------------------------------------------------------------------------
+ * 겹치는 UI(창, 드래그 미리보기, 툴팁 등)를 레이어 단위로 나누어 그리고,
+ * 바뀐 부분만 아래에서 위로 합성하여 대상 버퍼(Back Buffer)에 기록합니다.
+ * 각 레이어는 자신의 cc_buffer_t (_surface)를 가지므로 기존 draw 함수/Clip/뷰를 그대로 쓰고,
+ * 그 버퍼의 변경 범위(Dirty Span)가 곧 레이어의 변경 범위가 됩니다.
+ * 레이어를 옮기면 이전 자리와 새 자리만 다시 합성하므로 아래 레이어를 다시 그리지 않아도 됩니다.
+ *
+ * 투명: 배경색이 CC_COLOR_NONE 인 공백 셀은 아래가 그대로 보이고,
+ * 배경색(또는 글자색)만 CC_COLOR_NONE 인 셀은 아래 셀의 색 위에 글자만 올립니다.
+ * 새 레이어는 전체가 투명한 상태로 시작합니다.
+ *
+ * 사용 예:
+ *   cc_compositor_t* comp = cc_compositor_create( screen, &CC_COLOR_BLACK );
+ *   cc_layer_t* tip = cc_compositor_add_layer( comp, &rect, 10 );
+ *   cc_buffer_draw_string( tip->_surface, 0, 0, "Tooltip", &CC_COLOR_WHITE, &CC_COLOR_NONE );
+ *   cc_layer_move( tip, mx, my );
+ *   cc_compositor_compose( comp );
+ *   cc_buffer_flush( screen );
+ * ------------------------------------------------------------------------------------ */
+
+#include "console_c/cc_buffer.h"
+#include <stdbool.h>
+
+// -----------------------------------------------------------------------------
+// Data Structures
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief 합성 대상 레이어 (cc_compositor_add_layer 로 생성)
+ */
+typedef struct
+{
+    cc_buffer_t* _surface; /**< 레이어 내용 (cc_buffer_draw_* 로 그림, flush 하지 않음) */
+    int          _x;       /**< 화면 X 위치 */
+    int          _y;       /**< 화면 Y 위치 */
+    int          _z;       /**< 쌓는 순서 (클수록 위, 같으면 먼저 만든 레이어가 아래) */
+    bool         _visible; /**< 표시 여부 */
+
+    cc_rect_t    _shown_rect; /**< 마지막 합성 때 차지한 화면 영역 (숨김이면 빈 영역) */
+    int          _shown_z;    /**< 마지막 합성 때의 _z */
+} cc_layer_t;
+
+/**
+ * @brief 레이어 합성기
+ * @details 다시 합성할 화면 영역을 행별 열 범위(_damage)로 모아 두었다가 compose 때 한 번에 처리합니다.
+ */
+typedef struct
+{
+    cc_buffer_t*     _target;      /**< 합성 결과를 기록할 버퍼 */
+    cc_cell_t        _base;        /**< 어떤 레이어도 덮지 않은 칸 (배경색 공백) */
+
+    cc_layer_t**     _layers;      /**< 레이어 목록 (compose 시 _z 순으로 정렬) */
+    int              _layer_count;
+    int              _layer_cap;
+
+    cc_dirty_span_t* _damage;      /**< 행별 다시 합성할 열 범위 (_height개) */
+    int              _width;       /**< _damage 기준 대상 버퍼 너비 */
+    int              _height;      /**< _damage 기준 대상 버퍼 높이 */
+
+    cc_cell_t*       _row;         /**< 한 행 합성용 임시 버퍼 */
+    int              _row_cap;
+} cc_compositor_t;
+
+// -----------------------------------------------------------------------------
+// Function Prototypes
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief 합성기를 생성합니다. (첫 compose 는 화면 전체를 합성)
+ * @param target 합성 결과를 기록할 버퍼 (합성기보다 오래 살아 있어야 함)
+ * @param background 레이어가 없는 칸의 배경색 (NULL = 검정)
+ * @return 생성된 객체 (실패 시 NULL)
+ */
+cc_compositor_t* cc_compositor_create( cc_buffer_t* target, const cc_color_t* background );
+
+/**
+ * @brief 합성기와 소속 레이어를 모두 해제합니다.
+ * @param self 대상 객체
+ */
+void cc_compositor_destroy( cc_compositor_t* self );
+
+/**
+ * @brief 투명한 레이어를 추가합니다.
+ * @param self 대상 객체
+ * @param rect 레이어 위치와 크기 (화면 좌표계)
+ * @param z 쌓는 순서 (클수록 위)
+ * @return 생성된 레이어 (합성기가 소유, 실패 시 NULL)
+ */
+cc_layer_t* cc_compositor_add_layer( cc_compositor_t* self, const cc_rect_t* rect, int z );
+
+/**
+ * @brief 레이어를 제거하고 해제합니다. (차지하던 영역은 다음 compose 때 다시 합성)
+ * @param self 대상 객체
+ * @param layer 제거할 레이어
+ */
+void cc_compositor_remove_layer( cc_compositor_t* self, cc_layer_t* layer );
+
+/**
+ * @brief 화면 전체를 다음 compose 때 다시 합성하도록 표시합니다.
+ * @param self 대상 객체
+ */
+void cc_compositor_invalidate( cc_compositor_t* self );
+
+/**
+ * @brief 바뀐 레이어 내용, 이동/숨김/순서 변경된 레이어의 이전/현재 영역만 합성하여 대상 버퍼에 기록합니다.
+ * @details 대상 버퍼 크기가 바뀌었으면 전체를 합성합니다. 대상 버퍼의 Clip 영역 밖은 기록하지 않습니다.
+ * 이후 cc_buffer_flush( target )로 출력합니다.
+ * @param self 대상 객체
+ */
+void cc_compositor_compose( cc_compositor_t* self );
+
+/**
+ * @brief 레이어를 화면 (x, y)로 옮깁니다. (내용은 다시 그리지 않아도 됨)
+ */
+void cc_layer_move( cc_layer_t* self, int x, int y );
+
+/**
+ * @brief 레이어 크기를 바꿉니다. (겹치는 영역의 내용은 유지, 새로 생긴 영역은 투명)
+ * @return 성공 여부
+ */
+bool cc_layer_resize( cc_layer_t* self, int width, int height );
+
+/**
+ * @brief 레이어의 쌓는 순서를 바꿉니다.
+ */
+void cc_layer_set_z( cc_layer_t* self, int z );
+
+/**
+ * @brief 레이어를 보이거나 숨깁니다.
+ */
+void cc_layer_set_visible( cc_layer_t* self, bool visible );
+
+#endif // _CONSOLE_C_LAYER_H_
\ No newline at end of file
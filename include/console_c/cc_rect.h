@@ -0,0 +1,51 @@
+#ifndef _CONSOLE_C_RECT_H_
+#define _CONSOLE_C_RECT_H_
+
+/** ------------------------------------------------------------------------------------
+ * ConsoleC Rect Module Header
+ * ------------------------------------------------------------------------------------
+ * 버퍼, 레이어, 디스플레이 리스트가 함께 쓰는 사각 영역 타입과 연산입니다.
+ * ------------------------------------------------------------------------------------ */
+
+#include <stdbool.h>
+
+// -----------------------------------------------------------------------------
+// Data Structures
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief 사각 영역 구조체 (0-based, 버퍼 좌표계)
+ */
+typedef struct
+{
+    int _x; /**< 왼쪽 열 */
+    int _y; /**< 위쪽 행 */
+    int _w; /**< 너비 */
+    int _h; /**< 높이 */
+} cc_rect_t;
+
+// -----------------------------------------------------------------------------
+// Function Prototypes
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief 사각 영역을 생성합니다.
+ */
+cc_rect_t cc_rect_make( int x, int y, int w, int h );
+
+/**
+ * @brief 영역이 비어 있는지 (너비나 높이가 0 이하인지) 확인합니다.
+ */
+bool cc_rect_is_empty( cc_rect_t r );
+
+/**
+ * @brief 두 영역의 교집합을 구합니다. (겹치지 않으면 빈 영역)
+ */
+cc_rect_t cc_rect_intersect( cc_rect_t a, cc_rect_t b );
+
+/**
+ * @brief 좌표가 영역 안에 있는지 확인합니다.
+ */
+bool cc_rect_contains( cc_rect_t r, int x, int y );
+
+#endif // _CONSOLE_C_RECT_H_
\ No newline at end of file
@@ -0,0 +1,99 @@
+#ifndef _CONSOLE_C_SCHEDULER_H_
+#define _CONSOLE_C_SCHEDULER_H_
+
+/** ------------------------------------------------------------------------------------
+ * ConsoleC Frame Scheduler Module Header
+ * ------------------------------------------------------------------------------------
+ * 입력 대기와 화면 갱신 시점을 관리하는 메인 루프 도우미입니다.
+ * 다시 그리기 요청이 없으면 입력이 올 때까지 잠들고(CPU 0%), 요청이 있으면
+ * 목표 FPS를 넘지 않도록 다음 프레임 시각까지 입력을 받으며 기다립니다.
+ * 이미 도착한 입력은 그리기 전에 모두 처리하므로 입력이 몰려도 프레임은 한 번만 그립니다.
+ *
+ * 사용 예:
+ *   while( running ){
+ *       cc_key_code_e key = cc_scheduler_wait( &sched );
+ *       if( key != CC_KEY_NONE ){ handle( key ); cc_scheduler_request_redraw( &sched ); continue; }
+ *       if( cc_scheduler_begin_frame( &sched ) ){ render(); cc_buffer_flush( buf ); }
+ *   }
+ * ------------------------------------------------------------------------------------ */
+
+#include "console_c/cc_device.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+// -----------------------------------------------------------------------------
+// Constants
+// -----------------------------------------------------------------------------
+
+#define CC_SCHEDULER_MAX_BATCH 64 /**< 프레임 시각이 지난 뒤 그리기를 미루고 연속 처리할 최대 입력 수 */
+
+// -----------------------------------------------------------------------------
+// Data Structures
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief 프레임 스케줄러 상태
+ * @details 시각은 모두 CLOCK_MONOTONIC 기준 나노초입니다.
+ */
+typedef struct
+{
+    int64_t  _frame_interval; /**< 프레임 최소 간격 (0 = FPS 제한 없음) */
+    int64_t  _last_frame;     /**< 마지막 프레임 시작 시각 (0 = 아직 없음) */
+    int64_t  _wake_at;        /**< 예약된 다시 그리기 시각 (0 = 예약 없음) */
+    bool     _redraw;         /**< 다시 그리기 요청 여부 */
+    int      _batch;          /**< 마지막 프레임 이후 연속 처리한 입력 수 */
+    uint64_t _frame_count;    /**< 그린 프레임 수 */
+} cc_scheduler_t;
+
+// -----------------------------------------------------------------------------
+// Function Prototypes
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief 스케줄러를 초기화합니다. (첫 프레임은 다시 그리기가 요청된 상태로 시작)
+ * @param self 대상 객체
+ * @param target_fps 목표 FPS (0 이하 = 제한 없음)
+ */
+void cc_scheduler_init( cc_scheduler_t* self, int target_fps );
+
+/**
+ * @brief 목표 FPS를 변경합니다.
+ * @param self 대상 객체
+ * @param target_fps 목표 FPS (0 이하 = 제한 없음)
+ */
+void cc_scheduler_set_fps( cc_scheduler_t* self, int target_fps );
+
+/**
+ * @brief 다음 프레임 시각에 화면을 다시 그리도록 요청합니다.
+ * @details 여러 번 호출해도 프레임은 한 번만 그려집니다.
+ * @param self 대상 객체
+ */
+void cc_scheduler_request_redraw( cc_scheduler_t* self );
+
+/**
+ * @brief delay_ms 뒤에 화면을 다시 그리도록 예약합니다. (시계, 깜빡임 등 시간 기반 갱신용)
+ * @details 이미 더 이른 예약이 있으면 그 예약을 유지합니다.
+ * @param self 대상 객체
+ * @param delay_ms 지연 시간 (밀리초, 0 이하 = 즉시 요청)
+ */
+void cc_scheduler_request_redraw_after( cc_scheduler_t* self, int delay_ms );
+
+/**
+ * @brief 입력이 오거나 그릴 차례가 될 때까지 대기합니다.
+ * @details 이미 도착한 입력은 기다리지 않고 바로 반환합니다. 다시 그리기 요청이 없으면
+ * (예약 시각 외에는) 입력이 올 때까지 무한 대기합니다.
+ * @param self 대상 객체
+ * @return 입력 코드 (CC_KEY_NONE = 대기 입력 없음, cc_scheduler_begin_frame 으로 그릴 차례 확인)
+ */
+cc_key_code_e cc_scheduler_wait( cc_scheduler_t* self );
+
+/**
+ * @brief 지금 프레임을 그려야 하는지 확인하고, 그렇다면 요청을 소비합니다.
+ * @details 다시 그리기가 요청되었고 마지막 프레임 이후 프레임 간격이 지났을 때만 true 입니다.
+ * 렌더링이 늦어 놓친 프레임 시각은 따라잡지 않고 지금을 기준으로 다시 맞춥니다.
+ * @param self 대상 객체
+ * @return 그릴 차례이면 true
+ */
+bool cc_scheduler_begin_frame( cc_scheduler_t* self );
+
+#endif // _CONSOLE_C_SCHEDULER_H_
\ No newline at end of file
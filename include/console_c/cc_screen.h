@@ -9,6 +9,7 @@
  * ------------------------------------------------------------------------------------ */
 
 #include "console_c/cc_color.h"
+#include "console_c/cc_sink.h"
 #include <stdbool.h>
 
 // -----------------------------------------------------------------------------
@@ -43,6 +44,14 @@ extern const cc_coord_t CC_COORD_ORIGIN; /**< (1, 1) */
 // Public API
 // -----------------------------------------------------------------------------
 
+/**
+ * @brief cc_screen_* 의 커서/색상/청소 시퀀스를 받을 곳(Sink)을 지정합니다.
+ * @details 기본값(NULL)은 printf와 같이 stdio 표준 출력 버퍼를 거칩니다.
+ * Sink는 소유하지 않으므로 지정된 동안 살아 있어야 합니다.
+ * @param sink 출력 Sink (NULL = 표준 출력)
+ */
+void cc_screen_set_sink( cc_sink_t* sink );
+
 /**
  * @brief 현재 터미널 창의 크기(Col, Row)를 조회합니다.
  * @return 너비와 높이 정보 (실패 시 0,0)
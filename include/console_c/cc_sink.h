@@ -0,0 +1,151 @@
+#ifndef _CONSOLE_C_SINK_H_
+#define _CONSOLE_C_SINK_H_
+
+/** ------------------------------------------------------------------------------------
+ * ConsoleC Sink Module Header
+ * ------------------------------------------------------------------------------------
+ * cc_buffer_flush 와 cc_screen_* 가 만든 출력 바이트를 받을 곳(Sink)을 추상화합니다.
+ * 기본 출력은 표준 출력이며, fd(직접 연 pty 등), 메모리(헤드리스 렌더링, 벤치마크),
+ * 파일(FILE*), 콜백을 기본 제공하고, cc_sink_ops_t 를 채워 직접 만들 수도 있습니다.
+ *
+ * 사용 예:
+ *   cc_sink_t* mem = cc_sink_create_memory();
+ *   cc_buffer_set_sink( buffer, mem );
+ *   cc_buffer_flush( buffer );
+ *   size_t len;
+ *   const char* bytes = cc_sink_memory_data( mem, &len );
+ *   ...
+ *   cc_buffer_set_sink( buffer, NULL );   // 표준 출력으로 복귀
+ *   cc_sink_destroy( mem );
+ * ------------------------------------------------------------------------------------ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <sys/uio.h>
+
+// -----------------------------------------------------------------------------
+// Data Structures
+// -----------------------------------------------------------------------------
+
+typedef struct cc_sink_s cc_sink_t;
+
+/**
+ * @brief Sink 동작 테이블
+ * @details _write 외에는 NULL이어도 됩니다. (_writev = NULL 이면 조각마다 _write 호출)
+ */
+typedef struct
+{
+    bool (*_write)( cc_sink_t* self, const char* data, size_t len );          /**< len 바이트를 끝까지 씀 (실패 시 false) */
+    bool (*_writev)( cc_sink_t* self, const struct iovec* iov, int iovcnt ); /**< 여러 조각을 순서대로 씀 */
+    void (*_flush)( cc_sink_t* self );                                        /**< 내부 버퍼를 내보냄 */
+    void (*_interrupt)( cc_sink_t* self, bool interrupt );                    /**< 출력이 막혀 기다리는 쓰기를 중단 (다른 스레드에서 호출) */
+    void (*_destroy)( cc_sink_t* self );                                      /**< 자원 해제 (객체 메모리 포함) */
+} cc_sink_ops_t;
+
+/**
+ * @brief Sink 공통 헤더
+ * @details 직접 만드는 Sink는 이 구조체를 첫 멤버로 두고 _ops 를 채웁니다.
+ */
+struct cc_sink_s
+{
+    const cc_sink_ops_t* _ops;
+};
+
+/**
+ * @brief 콜백 Sink가 호출하는 함수 (user = cc_sink_create_callback 에 넘긴 값)
+ * @return 성공 여부
+ */
+typedef bool (*cc_sink_write_fn)( void* user, const char* data, size_t len );
+
+// -----------------------------------------------------------------------------
+// Function Prototypes
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief 표준 출력 Sink (라이브러리 공용, 해제 불필요)
+ * @details 쓰기 전에 stdio 버퍼(printf 등)를 먼저 내보내 출력 순서를 유지한 뒤 write()로 직접 씁니다.
+ * @return 공용 Sink
+ */
+cc_sink_t* cc_sink_stdout( void );
+
+/**
+ * @brief fd에 write()/writev()로 직접 쓰는 Sink를 생성합니다.
+ * @details stdio를 거치지 않으며, 부분 쓰기/EINTR/EAGAIN(Non-blocking fd)은 끝까지 이어서 씁니다.
+ * @param fd 출력 fd
+ * @param owns_fd true면 Sink 해제 시 fd도 닫음
+ * @return 생성된 Sink (실패 시 NULL)
+ */
+cc_sink_t* cc_sink_create_fd( int fd, bool owns_fd );
+
+/**
+ * @brief 쓴 내용을 메모리에 이어 붙이는 Sink를 생성합니다. (필요할 때만 2배씩 확장)
+ * @return 생성된 Sink (실패 시 NULL)
+ */
+cc_sink_t* cc_sink_create_memory( void );
+
+/**
+ * @brief FILE* 에 fwrite로 쓰는 Sink를 생성합니다.
+ * @param fp 출력 파일
+ * @param owns_file true면 Sink 해제 시 fclose
+ * @return 생성된 Sink (실패 시 NULL)
+ */
+cc_sink_t* cc_sink_create_file( FILE* fp, bool owns_file );
+
+/**
+ * @brief 쓸 때마다 fn 을 호출하는 Sink를 생성합니다.
+ * @param fn 호출할 함수
+ * @param user fn 에 그대로 전달할 값
+ * @return 생성된 Sink (실패 시 NULL)
+ */
+cc_sink_t* cc_sink_create_callback( cc_sink_write_fn fn, void* user );
+
+/**
+ * @brief Sink를 해제합니다. (cc_sink_stdout 은 무시)
+ * @param self 대상 Sink
+ */
+void cc_sink_destroy( cc_sink_t* self );
+
+/**
+ * @brief len 바이트를 씁니다.
+ * @return 성공 여부
+ */
+bool cc_sink_write( cc_sink_t* self, const char* data, size_t len );
+
+/**
+ * @brief 여러 조각을 순서대로 씁니다. (fd Sink는 writev 한 번으로 전송)
+ * @return 성공 여부
+ */
+bool cc_sink_writev( cc_sink_t* self, const struct iovec* iov, int iovcnt );
+
+/**
+ * @brief Sink 내부 버퍼를 내보냅니다. (파일 Sink: fflush)
+ * @param self 대상 Sink
+ */
+void cc_sink_flush( cc_sink_t* self );
+
+/**
+ * @brief 출력이 막혀 기다리는 쓰기를 중단시킵니다. (쓰는 스레드와 다른 스레드에서 호출 가능)
+ * @details 켜져 있는 동안 fd Sink는 출력 대상이 받아주지 않으면 기다리지 않고 실패로 반환합니다.
+ * (이미 기다리는 중이면 짧은 대기 단위 안에 깨어남) 받아주는 동안은 그대로 씁니다.
+ * 기다리는 동작이 없는 Sink에는 아무 효과가 없습니다.
+ * @param self 대상 Sink
+ * @param interrupt true = 중단, false = 다시 기다리며 씀
+ */
+void cc_sink_interrupt( cc_sink_t* self, bool interrupt );
+
+/**
+ * @brief 메모리 Sink에 쌓인 내용을 반환합니다.
+ * @param self 메모리 Sink
+ * @param out_len 길이를 받을 변수 (NULL 가능)
+ * @return 내용 (NULL 종료 아님, 메모리 Sink가 아니거나 비었으면 NULL)
+ */
+const char* cc_sink_memory_data( const cc_sink_t* self, size_t* out_len );
+
+/**
+ * @brief 메모리 Sink의 내용을 비웁니다. (할당된 메모리는 재사용)
+ * @param self 메모리 Sink
+ */
+void cc_sink_memory_clear( cc_sink_t* self );
+
+#endif // _CONSOLE_C_SINK_H_
\ No newline at end of file
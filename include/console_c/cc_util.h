@@ -66,4 +66,38 @@ bool cc_util_strip_ansi_codes( const char* src, char* out_buf, size_t buf_len );
  */
 bool cc_util_is_double_width( uint32_t codepoint );
 
+/**
+ * @brief 단일 코드포인트의 콘솔 출력 너비를 반환합니다.
+ * @param codepoint 유니코드 코드포인트
+ * @return 0 (결합 문자 등), 1 (일반), 2 (한글/CJK/이모지 등)
+ */
+int cc_util_get_codepoint_width( uint32_t codepoint );
+
+/**
+ * @brief UTF-8 문자열에서 첫 글자(Grapheme Cluster)의 길이와 너비를 구합니다.
+ * @details 결합 문자, 이형 선택자, ZWJ로 이어진 이모지, 국기(지역 표시 문자 2개)를
+ * 앞 글자와 합쳐 한 글자로 봅니다. 너비는 첫 코드포인트의 너비이며,
+ * 이모지 표현 선택자(U+FE0F)가 붙거나 국기이면 2칸입니다.
+ * @param str UTF-8 문자열 (NULL 종료)
+ * @param out_width [Output] 글자의 출력 너비 (0~2)
+ * @return 글자의 바이트 길이 (문자열 끝이면 0)
+ */
+int cc_util_next_cluster( const char* str, int* out_width );
+
+/**
+ * @brief UTF-8 문자열에서 첫 문자를 디코딩합니다.
+ * @param str UTF-8 문자열 (NULL 종료)
+ * @param out_codepoint [Output] 추출된 코드포인트 (잘못된 시퀀스면 0)
+ * @return 소비한 바이트 수 (1~4), 잘못된 시퀀스는 1
+ */
+int cc_util_decode_utf8( const char* str, uint32_t* out_codepoint );
+
+/**
+ * @brief 코드포인트를 UTF-8 바이트로 인코딩합니다.
+ * @param codepoint 유니코드 코드포인트
+ * @param out_buf [Output] 결과 버퍼 (최소 4바이트, NULL 종료하지 않음)
+ * @return 작성된 바이트 수 (1~4)
+ */
+int cc_util_encode_utf8( uint32_t codepoint, char* out_buf );
+
 #endif // _CONSOLE_C_UTIL_H_
\ No newline at end of file
@@ -4,65 +4,2095 @@
  * cc_buffer.h 의 구현부입니다.
  * ------------------------------------------------------------------------------------ */
 
+// Feature Test Macros (for ttyname, O_CLOEXEC)
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
 #include "console_c/cc_buffer.h"
+#include "cc_buffer_internal.h"
 #include "console_c/cc_util.h"
+#include "console_c/cc_glyph.h"
 
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
+#include <limits.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <pthread.h>
+
+// SIMD 비교 커널 선택 (AVX2 > SSE2 > Scalar)
+#if defined( __AVX2__ )
+    #include <immintrin.h>
+    #define CC_DIFF_BLOCK 8 /**< 커널 1회에 비교하는 셀 수 (96 bytes = 32B x 3) */
+#elif defined( __SSE2__ )
+    #include <emmintrin.h>
+    #define CC_DIFF_BLOCK 4 /**< 커널 1회에 비교하는 셀 수 (48 bytes = 16B x 3) */
+#else
+    #define CC_DIFF_BLOCK 1
+#endif
 
 // -----------------------------------------------------------------------------
 // Internal Macros & Helpers
 // -----------------------------------------------------------------------------
 
-#define INDEX( _buf, _x, _y ) ( ( _y ) * ( _buf )->_width + ( _x ) )
+#define INDEX( _buf, _x, _y ) ( ( _y ) * ( _buf )->_width + ( _x ) )
+
+#define CC_FLUSH_CELL_MAX    128  /**< 셀 하나를 인코딩할 때 필요한 최대 바이트 (이동 + 색상 + 문자, 결합 문자는 최대 CC_GLYPH_MAX_BYTES) */
+#define CC_FLUSH_INIT_CAP    4096 /**< 출력 버퍼 초기 크기 */
+#define CC_FLUSH_MIN_LIMIT   256  /**< 출력 버퍼 최대 크기 하한 */
+#define CC_PARALLEL_MIN_ROWS 8    /**< 병렬 flush를 사용할 밴드당 최소 변경 행 수 */
+#define CC_SYNC_SEQ_LEN      8    /**< 동기화 출력 시작/끝 시퀀스 길이 ("\033[?2026h") */
+#define CC_FILL_CHUNK        1024 /**< 채우기 복제 단위 (셀 수, 12KB) */
+
+#define CC_SCROLL_DETECT_MIN 2 /**< 자동 스크롤을 사용할 최소 이득 (다시 그리지 않아도 되는 행 수) */
+#define CC_SCROLL_CANDIDATES 4 /**< 행마다 확인할 이동 후보 수 (가까운 순) */
+
+/**
+ * @brief cc_color_t 를 32비트 셀 색상(0xTTRRGGBB)으로 압축
+ * @details RGB가 아닌 타입(RESET/NONE)은 RGB 값을 0으로 정규화하여
+ * cc_color_is_equal 과 같은 비교 결과가 나오도록 합니다.
+ */
+static uint32_t _pack_color( const cc_color_t* color )
+{
+    uint32_t type = (uint32_t)color->_type << CC_CELL_TYPE_SHIFT;
+    if( color->_type != CC_COLOR_TYPE_RGB ) return type;
+
+    return type | ( (uint32_t)color->_rgb._r << 16 )
+                | ( (uint32_t)color->_rgb._g << 8 )
+                | (uint32_t)color->_rgb._b;
+}
+
+/**
+ * @brief 두 Cell이 동일한지 비교 (정수 비교 3회)
+ */
+static bool _is_cell_equal( const cc_cell_t* lhs, const cc_cell_t* rhs )
+{
+    return lhs->_glyph == rhs->_glyph &&
+           lhs->_fg    == rhs->_fg    &&
+           lhs->_bg    == rhs->_bg;
+}
+
+/**
+ * @brief (x, y)부터 width칸을 덮어쓰기 전, 걸쳐 있는 2칸 문자의 반쪽을 공백으로 정리
+ * @details 2칸 문자의 앞/뒤 절반만 덮어쓰면 터미널은 나머지 절반도 지우므로
+ * Back Buffer에도 같은 결과(공백)를 반영하여 Front Buffer와 화면이 어긋나지 않게 합니다.
+ */
+static void _break_wide_pair( cc_buffer_t* self, int x, int y, int width )
+{
+    cc_cell_t* row = &self->_back_buffer[INDEX( self, 0, y )];
+
+    // 덮어쓸 첫 칸이 Trail이면 앞쪽 Lead를 공백으로
+    if( x > 0 && ( CELL_FLAGS( &row[x] ) & CC_CELL_FLAG_WIDE_TRAIL ) ){
+        row[x - 1]._glyph = ' ';
+    }
+
+    // 덮어쓸 마지막 칸 다음이 Trail이면 (Lead를 덮어쓰게 되므로) Trail을 공백으로
+    int next = x + width;
+    if( next < self->_width && ( CELL_FLAGS( &row[next] ) & CC_CELL_FLAG_WIDE_TRAIL ) ){
+        row[next]._glyph = ' ';
+    }
+}
+
+/**
+ * @brief x 열을 경계로 걸쳐 있는 2칸 문자를 공백 두 칸으로 쪼갬 (영역 단위 이동 전 사용)
+ */
+static void _split_wide_at( cc_cell_t* row, int width, int x )
+{
+    if( x <= 0 || x >= width ) return;
+    if( CELL_FLAGS( &row[x] ) & CC_CELL_FLAG_WIDE_TRAIL ){
+        row[x - 1]._glyph = ' ';
+        row[x]._glyph     = ' ';
+    }
+}
+
+/**
+ * @brief 변경 추적 배열을 height 행 기준으로 (재)할당하고 깨끗한 상태로 초기화
+ * @details 앞쪽 keep_rows 행의 변경 범위는 유지합니다. (현재 _width 기준으로 잘라냄)
+ */
+static bool _alloc_dirty( cc_buffer_t* self, int height, int keep_rows )
+{
+    size_t words = ( (size_t)height + 63 ) / 64;
+
+    uint64_t*        rows  = (uint64_t*)realloc( self->_dirty_rows, sizeof( uint64_t ) * words );
+    if( rows ) self->_dirty_rows = rows;
+    cc_dirty_span_t* spans = (cc_dirty_span_t*)realloc( self->_dirty_spans, sizeof( cc_dirty_span_t ) * height );
+    if( spans ) self->_dirty_spans = spans;
+    uint64_t*        hashes = (uint64_t*)realloc( self->_row_hashes, sizeof( uint64_t ) * 2 * height );
+    if( hashes ) self->_row_hashes = hashes;
+
+    if( !rows || !spans || !hashes ) return false;
+
+    memset( rows, 0, sizeof( uint64_t ) * words );
+    for( int y = 0; y < height; ++y ){
+        if( y < keep_rows && spans[y]._min_x < self->_width && spans[y]._min_x <= spans[y]._max_x ){
+            if( spans[y]._max_x >= self->_width ) spans[y]._max_x = self->_width - 1;
+            rows[y >> 6] |= (uint64_t)1 << ( y & 63 );
+            continue;
+        }
+        spans[y]._min_x = INT_MAX;
+        spans[y]._max_x = -1;
+    }
+    return true;
+}
+
+/**
+ * @brief y행의 [x0, x1] 범위를 변경됨으로 기록 (범위는 버퍼 안으로 보정)
+ */
+static void _mark_dirty( cc_buffer_t* self, int y, int x0, int x1 )
+{
+    if( y < 0 || y >= self->_height ) return;
+    if( x0 < 0 ) x0 = 0;
+    if( x1 >= self->_width ) x1 = self->_width - 1;
+    if( x0 > x1 ) return;
+
+    cc_dirty_span_t* span = &self->_dirty_spans[y];
+    if( x0 < span->_min_x ) span->_min_x = x0;
+    if( x1 > span->_max_x ) span->_max_x = x1;
+    self->_dirty_rows[y >> 6] |= (uint64_t)1 << ( y & 63 );
+}
+
+/**
+ * @brief 버퍼 전체를 변경됨으로 기록
+ */
+static void _mark_all_dirty( cc_buffer_t* self )
+{
+    for( int y = 0; y < self->_height; ++y ){
+        self->_dirty_spans[y]._min_x = 0;
+        self->_dirty_spans[y]._max_x = self->_width - 1;
+    }
+    size_t words = ( (size_t)self->_height + 63 ) / 64;
+    memset( self->_dirty_rows, 0xFF, sizeof( uint64_t ) * words );
+
+    // 마지막 워드에서 height를 넘는 비트는 끔
+    if( self->_height & 63 ){
+        self->_dirty_rows[words - 1] = ( (uint64_t)1 << ( self->_height & 63 ) ) - 1;
+    }
+}
+
+/**
+ * @brief Front Buffer를 "알 수 없음"으로 만들어 다음 flush에서 전체를 다시 출력하게 함
+ * @details 어떤 Back 셀과도 같지 않은 글리프(CC_CELL_GLYPH_INVALID)로 채웁니다.
+ */
+static void _invalidate_front( cc_buffer_t* self )
+{
+    cc_cell_t invalid = { CC_CELL_GLYPH_INVALID, 0, 0 };
+    int count = self->_width * self->_height;
+
+    for( int i = 0; i < count; ++i ){
+        self->_front_buffer[i] = invalid;
+    }
+    _mark_all_dirty( self );
+}
+
+/**
+ * @brief 연속된 셀 count개를 value로 채움
+ * @details 첫 셀을 쓴 뒤 이미 채운 앞부분을 memcpy로 두 배씩 복제합니다.
+ * 복제 단위는 CC_FILL_CHUNK 셀로 제한하여 원본이 L1 캐시에 머물게 합니다.
+ */
+static void _fill_cells( cc_cell_t* cells, size_t count, cc_cell_t value )
+{
+    if( count == 0 ) return;
+
+    cells[0] = value;
+    size_t filled = 1;
+    while( filled < count ){
+        size_t n = ( filled < CC_FILL_CHUNK ) ? filled : CC_FILL_CHUNK;
+        if( n > count - filled ) n = count - filled;
+        memcpy( cells + filled, cells, sizeof( cc_cell_t ) * n );
+        filled += n;
+    }
+}
+
+/**
+ * @brief 셀 배열의 사각 영역을 value로 채움 (첫 행을 템플릿으로 만들어 나머지 행에 복사)
+ */
+static void _fill_rect( cc_cell_t* cells, int stride, int x, int y, int w, int h, cc_cell_t value )
+{
+    if( w <= 0 || h <= 0 ) return;
+
+    cc_cell_t* first = &cells[y * stride + x];
+
+    // 전체 너비이면 영역이 연속되므로 한 번에 채움
+    if( w == stride ){
+        _fill_cells( first, (size_t)w * h, value );
+        return;
+    }
+
+    _fill_cells( first, (size_t)w, value );
+    for( int row = 1; row < h; ++row ){
+        memcpy( first + row * stride, first, sizeof( cc_cell_t ) * w );
+    }
+}
+
+/**
+ * @brief 셀 배열의 사각 영역 안에서 행들을 dy만큼 이동 (드러난 행은 그대로 둠)
+ */
+static void _shift_rows( cc_cell_t* cells, int stride, const cc_rect_t* rect, int dy )
+{
+    size_t bytes = sizeof( cc_cell_t ) * rect->_w;
+    int    top   = rect->_y;
+    int    bot   = rect->_y + rect->_h - 1;
+
+    if( dy < 0 ){
+        // 위로 이동: 위쪽 행부터 복사
+        for( int y = top; y <= bot + dy; ++y ){
+            memcpy( &cells[y * stride + rect->_x], &cells[( y - dy ) * stride + rect->_x], bytes );
+        }
+    }
+    else{
+        // 아래로 이동: 아래쪽 행부터 복사
+        for( int y = bot; y >= top + dy; --y ){
+            memcpy( &cells[y * stride + rect->_x], &cells[( y - dy ) * stride + rect->_x], bytes );
+        }
+    }
+}
+
+/**
+ * @brief 전체 너비 영역 [top, bottom] 의 Front를 dy행 이동하고 드러난 행을 무효화 + 변경됨으로 기록
+ * @details Back은 건드리지 않습니다. 영역 안 행들의 변경 범위(Dirty Span)도 함께 이동합니다.
+ */
+static void _shift_front( cc_buffer_t* self, int top, int bottom, int dy )
+{
+    cc_rect_t rect    = { 0, top, self->_width, bottom - top + 1 };
+    cc_cell_t invalid = { CC_CELL_GLYPH_INVALID, 0, 0 };
+
+    _shift_rows( self->_front_buffer, self->_width, &rect, dy );
+
+    // 변경 범위 이동 (Front와 Back이 같이 움직였다면 차이도 같이 움직임)
+    int exposed_top = ( dy < 0 ) ? bottom + dy + 1 : top;
+    int exposed_bot = ( dy < 0 ) ? bottom : top + dy - 1;
+    if( dy < 0 ){
+        memmove( &self->_dirty_spans[top], &self->_dirty_spans[top - dy], sizeof( cc_dirty_span_t ) * ( rect._h + dy ) );
+    } else {
+        memmove( &self->_dirty_spans[top + dy], &self->_dirty_spans[top], sizeof( cc_dirty_span_t ) * ( rect._h - dy ) );
+    }
+
+    for( int y = top; y <= bottom; ++y ){
+        uint64_t bit = (uint64_t)1 << ( y & 63 );
+        if( y >= exposed_top && y <= exposed_bot ){
+            _fill_rect( self->_front_buffer, self->_width, 0, y, self->_width, 1, invalid );
+            self->_dirty_spans[y]._min_x = 0;
+            self->_dirty_spans[y]._max_x = self->_width - 1;
+        }
+
+        if( self->_dirty_spans[y]._min_x <= self->_dirty_spans[y]._max_x ){
+            self->_dirty_rows[y >> 6] |= bit;
+        } else {
+            self->_dirty_rows[y >> 6] &= ~bit;
+        }
+    }
+}
+
+/**
+ * @brief 앞쪽 rows 행을 old_w 너비 배치에서 new_w 너비 배치로 제자리 이동 (겹치는 열만 보존)
+ * @details 배열은 두 배치를 모두 담을 수 있어야 합니다. 좁아질 때는 위쪽 행부터,
+ * 넓어질 때는 아래쪽 행부터 옮겨 아직 옮기지 않은 행을 덮어쓰지 않습니다.
+ */
+static void _relayout_rows( cc_cell_t* cells, int old_w, int new_w, int rows )
+{
+    if( old_w == new_w ) return;
+
+    size_t bytes = sizeof( cc_cell_t ) * ( ( new_w < old_w ) ? new_w : old_w );
+    if( new_w < old_w ){
+        for( int y = 1; y < rows; ++y ){
+            memmove( &cells[y * new_w], &cells[y * old_w], bytes );
+        }
+    }
+    else{
+        for( int y = rows - 1; y > 0; --y ){
+            memmove( &cells[y * new_w], &cells[y * old_w], bytes );
+        }
+    }
+}
+
+/**
+ * @brief 내부 버퍼 초기화 (Resize, Clear 등에서 사용)
+ */
+static void _fill_buffer( cc_cell_t* buffer, int count, const cc_color_t* bg )
+{
+    cc_cell_t blank;
+    blank._glyph = ' ';
+    blank._fg    = _pack_color( &CC_COLOR_WHITE );
+    blank._bg    = _pack_color( ( bg ) ? bg : &CC_COLOR_BLACK );
+
+    _fill_cells( buffer, (size_t)count, blank );
+}
+
+/**
+ * @brief 현재 Clip 영역(_clip)을 스택 맨 위와 버퍼 범위로 다시 계산
+ */
+static void _update_clip( cc_buffer_t* self )
+{
+    cc_rect_t bounds = { 0, 0, self->_width, self->_height };
+    self->_clip = ( self->_clip_depth > 0 ) ? cc_rect_intersect( self->_clip_stack[self->_clip_depth - 1], bounds ) : bounds;
+}
+
+// -----------------------------------------------------------------------------
+// Diff Kernel
+// -----------------------------------------------------------------------------
+
+#if CC_DIFF_BLOCK > 1
+/**
+ * @brief 셀 CC_DIFF_BLOCK개를 한 번에 비교하여 32비트 레인별 일치 마스크를 반환
+ * @details cc_cell_t는 32비트 필드 3개이므로 셀 k는 비트 3k..3k+2에 대응합니다.
+ */
+static uint32_t _diff_lane_mask( const cc_cell_t* front, const cc_cell_t* back )
+{
+    const char* f = (const char*)front;
+    const char* b = (const char*)back;
+    uint32_t mask = 0;
+
+#if defined( __AVX2__ )
+    for( int k = 0; k < 3; ++k ){
+        __m256i fv = _mm256_loadu_si256( (const __m256i*)( f + k * 32 ) );
+        __m256i bv = _mm256_loadu_si256( (const __m256i*)( b + k * 32 ) );
+        __m256  eq = _mm256_castsi256_ps( _mm256_cmpeq_epi32( fv, bv ) );
+        mask |= (uint32_t)_mm256_movemask_ps( eq ) << ( k * 8 );
+    }
+#else
+    for( int k = 0; k < 3; ++k ){
+        __m128i fv = _mm_loadu_si128( (const __m128i*)( f + k * 16 ) );
+        __m128i bv = _mm_loadu_si128( (const __m128i*)( b + k * 16 ) );
+        __m128  eq = _mm_castsi128_ps( _mm_cmpeq_epi32( fv, bv ) );
+        mask |= (uint32_t)_mm_movemask_ps( eq ) << ( k * 4 );
+    }
+#endif
+    return mask;
+}
+#endif
+
+/**
+ * @brief [from, to) 범위에서 (front == back) 여부가 want_equal 과 같은 첫 셀을 찾음
+ * @return 찾은 셀 인덱스, 없으면 to
+ * @details 블록 단위로 비교한 뒤 셀 k의 3개 레인을 접어(비트 3k) 한 번에 판정합니다.
+ */
+static int _diff_scan( const cc_cell_t* front, const cc_cell_t* back, int from, int to, bool want_equal )
+{
+    int x = from;
+
+#if CC_DIFF_BLOCK > 1
+    // 각 셀의 첫 레인 위치 (비트 0, 3, 6, ...)
+    const uint32_t cell_bits = ( CC_DIFF_BLOCK == 8 ) ? 0x249249u : 0x249u;
+
+    for( ; x + CC_DIFF_BLOCK <= to; x += CC_DIFF_BLOCK ){
+        uint32_t eq   = _diff_lane_mask( front + x, back + x );
+        uint32_t hits = want_equal ? ( eq & ( eq >> 1 ) & ( eq >> 2 ) )
+                                   : ( ~eq | ( ~eq >> 1 ) | ( ~eq >> 2 ) );
+        hits &= cell_bits;
+        if( hits ){
+            return x + __builtin_ctz( hits ) / 3;
+        }
+    }
+#endif
+
+    for( ; x < to; ++x ){
+        if( _is_cell_equal( &front[x], &back[x] ) == want_equal ){
+            return x;
+        }
+    }
+    return to;
+}
+
+// -----------------------------------------------------------------------------
+// Flush Encoder
+// -----------------------------------------------------------------------------
+
+#define CC_SGR_UNKNOWN    0xFFFFFFFFu /**< 터미널 색상 상태를 모름 (어떤 셀 색상과도 다른 값) */
+#define CC_SGR_TYPE_INDEX 3u          /**< 팔레트 인덱스로 변환된 색상 타입 (flush 내부 전용) */
+
+/**
+ * @brief flush 중 터미널 상태(커서/색상)와 출력 위치를 추적하는 컨텍스트
+ */
+typedef struct
+{
+    char**   _buf;       /**< 출력 버퍼 (소유자의 포인터, 확장 시 갱신) */
+    size_t*  _cap;       /**< 출력 버퍼 크기 (소유자의 값) */
+    size_t   _limit;     /**< 출력 버퍼 최대 크기 (0 = 무제한) */
+    char*    _ptr;       /**< 다음 출력 위치 */
+    char*    _end;       /**< 출력 버퍼 끝 */
+    int      _cursor_x;  /**< 터미널 커서 X (1-based, -1 = 모름) */
+    int      _cursor_y;  /**< 터미널 커서 Y (1-based, -1 = 모름) */
+    uint32_t _fg;        /**< 터미널의 현재 글자색 (CC_SGR_UNKNOWN = 모름) */
+    uint32_t _bg;        /**< 터미널의 현재 배경색 (CC_SGR_UNKNOWN = 모름) */
+    cc_color_mode_e _color_mode; /**< 출력 색상 모드 */
+    uint32_t        _caps;       /**< 사용할 터미널 기능 (CC_TERM_CAP_*) */
+    size_t          _streamed;   /**< 버퍼가 가득 차 먼저 출력한 바이트 수 */
+    cc_sink_t*      _sink;       /**< 출력 Sink */
+} flush_ctx_t;
+
+/**
+ * @brief 0~255 10진수 문자열 테이블 ([3] = 자릿수)
+ * @details SGR 색상 파라미터 출력 시 snprintf 대신 사용합니다.
+ */
+static const char _DEC_TABLE[256][4] =
+{
+    { '0', 0, 0, 1 }, { '1', 0, 0, 1 }, { '2', 0, 0, 1 }, { '3', 0, 0, 1 }, { '4', 0, 0, 1 }, { '5', 0, 0, 1 }, { '6', 0, 0, 1 }, { '7', 0, 0, 1 },
+    { '8', 0, 0, 1 }, { '9', 0, 0, 1 }, { '1', '0', 0, 2 }, { '1', '1', 0, 2 }, { '1', '2', 0, 2 }, { '1', '3', 0, 2 }, { '1', '4', 0, 2 }, { '1', '5', 0, 2 },
+    { '1', '6', 0, 2 }, { '1', '7', 0, 2 }, { '1', '8', 0, 2 }, { '1', '9', 0, 2 }, { '2', '0', 0, 2 }, { '2', '1', 0, 2 }, { '2', '2', 0, 2 }, { '2', '3', 0, 2 },
+    { '2', '4', 0, 2 }, { '2', '5', 0, 2 }, { '2', '6', 0, 2 }, { '2', '7', 0, 2 }, { '2', '8', 0, 2 }, { '2', '9', 0, 2 }, { '3', '0', 0, 2 }, { '3', '1', 0, 2 },
+    { '3', '2', 0, 2 }, { '3', '3', 0, 2 }, { '3', '4', 0, 2 }, { '3', '5', 0, 2 }, { '3', '6', 0, 2 }, { '3', '7', 0, 2 }, { '3', '8', 0, 2 }, { '3', '9', 0, 2 },
+    { '4', '0', 0, 2 }, { '4', '1', 0, 2 }, { '4', '2', 0, 2 }, { '4', '3', 0, 2 }, { '4', '4', 0, 2 }, { '4', '5', 0, 2 }, { '4', '6', 0, 2 }, { '4', '7', 0, 2 },
+    { '4', '8', 0, 2 }, { '4', '9', 0, 2 }, { '5', '0', 0, 2 }, { '5', '1', 0, 2 }, { '5', '2', 0, 2 }, { '5', '3', 0, 2 }, { '5', '4', 0, 2 }, { '5', '5', 0, 2 },
+    { '5', '6', 0, 2 }, { '5', '7', 0, 2 }, { '5', '8', 0, 2 }, { '5', '9', 0, 2 }, { '6', '0', 0, 2 }, { '6', '1', 0, 2 }, { '6', '2', 0, 2 }, { '6', '3', 0, 2 },
+    { '6', '4', 0, 2 }, { '6', '5', 0, 2 }, { '6', '6', 0, 2 }, { '6', '7', 0, 2 }, { '6', '8', 0, 2 }, { '6', '9', 0, 2 }, { '7', '0', 0, 2 }, { '7', '1', 0, 2 },
+    { '7', '2', 0, 2 }, { '7', '3', 0, 2 }, { '7', '4', 0, 2 }, { '7', '5', 0, 2 }, { '7', '6', 0, 2 }, { '7', '7', 0, 2 }, { '7', '8', 0, 2 }, { '7', '9', 0, 2 },
+    { '8', '0', 0, 2 }, { '8', '1', 0, 2 }, { '8', '2', 0, 2 }, { '8', '3', 0, 2 }, { '8', '4', 0, 2 }, { '8', '5', 0, 2 }, { '8', '6', 0, 2 }, { '8', '7', 0, 2 },
+    { '8', '8', 0, 2 }, { '8', '9', 0, 2 }, { '9', '0', 0, 2 }, { '9', '1', 0, 2 }, { '9', '2', 0, 2 }, { '9', '3', 0, 2 }, { '9', '4', 0, 2 }, { '9', '5', 0, 2 },
+    { '9', '6', 0, 2 }, { '9', '7', 0, 2 }, { '9', '8', 0, 2 }, { '9', '9', 0, 2 }, { '1', '0', '0', 3 }, { '1', '0', '1', 3 }, { '1', '0', '2', 3 }, { '1', '0', '3', 3 },
+    { '1', '0', '4', 3 }, { '1', '0', '5', 3 }, { '1', '0', '6', 3 }, { '1', '0', '7', 3 }, { '1', '0', '8', 3 }, { '1', '0', '9', 3 }, { '1', '1', '0', 3 }, { '1', '1', '1', 3 },
+    { '1', '1', '2', 3 }, { '1', '1', '3', 3 }, { '1', '1', '4', 3 }, { '1', '1', '5', 3 }, { '1', '1', '6', 3 }, { '1', '1', '7', 3 }, { '1', '1', '8', 3 }, { '1', '1', '9', 3 },
+    { '1', '2', '0', 3 }, { '1', '2', '1', 3 }, { '1', '2', '2', 3 }, { '1', '2', '3', 3 }, { '1', '2', '4', 3 }, { '1', '2', '5', 3 }, { '1', '2', '6', 3 }, { '1', '2', '7', 3 },
+    { '1', '2', '8', 3 }, { '1', '2', '9', 3 }, { '1', '3', '0', 3 }, { '1', '3', '1', 3 }, { '1', '3', '2', 3 }, { '1', '3', '3', 3 }, { '1', '3', '4', 3 }, { '1', '3', '5', 3 },
+    { '1', '3', '6', 3 }, { '1', '3', '7', 3 }, { '1', '3', '8', 3 }, { '1', '3', '9', 3 }, { '1', '4', '0', 3 }, { '1', '4', '1', 3 }, { '1', '4', '2', 3 }, { '1', '4', '3', 3 },
+    { '1', '4', '4', 3 }, { '1', '4', '5', 3 }, { '1', '4', '6', 3 }, { '1', '4', '7', 3 }, { '1', '4', '8', 3 }, { '1', '4', '9', 3 }, { '1', '5', '0', 3 }, { '1', '5', '1', 3 },
+    { '1', '5', '2', 3 }, { '1', '5', '3', 3 }, { '1', '5', '4', 3 }, { '1', '5', '5', 3 }, { '1', '5', '6', 3 }, { '1', '5', '7', 3 }, { '1', '5', '8', 3 }, { '1', '5', '9', 3 },
+    { '1', '6', '0', 3 }, { '1', '6', '1', 3 }, { '1', '6', '2', 3 }, { '1', '6', '3', 3 }, { '1', '6', '4', 3 }, { '1', '6', '5', 3 }, { '1', '6', '6', 3 }, { '1', '6', '7', 3 },
+    { '1', '6', '8', 3 }, { '1', '6', '9', 3 }, { '1', '7', '0', 3 }, { '1', '7', '1', 3 }, { '1', '7', '2', 3 }, { '1', '7', '3', 3 }, { '1', '7', '4', 3 }, { '1', '7', '5', 3 },
+    { '1', '7', '6', 3 }, { '1', '7', '7', 3 }, { '1', '7', '8', 3 }, { '1', '7', '9', 3 }, { '1', '8', '0', 3 }, { '1', '8', '1', 3 }, { '1', '8', '2', 3 }, { '1', '8', '3', 3 },
+    { '1', '8', '4', 3 }, { '1', '8', '5', 3 }, { '1', '8', '6', 3 }, { '1', '8', '7', 3 }, { '1', '8', '8', 3 }, { '1', '8', '9', 3 }, { '1', '9', '0', 3 }, { '1', '9', '1', 3 },
+    { '1', '9', '2', 3 }, { '1', '9', '3', 3 }, { '1', '9', '4', 3 }, { '1', '9', '5', 3 }, { '1', '9', '6', 3 }, { '1', '9', '7', 3 }, { '1', '9', '8', 3 }, { '1', '9', '9', 3 },
+    { '2', '0', '0', 3 }, { '2', '0', '1', 3 }, { '2', '0', '2', 3 }, { '2', '0', '3', 3 }, { '2', '0', '4', 3 }, { '2', '0', '5', 3 }, { '2', '0', '6', 3 }, { '2', '0', '7', 3 },
+    { '2', '0', '8', 3 }, { '2', '0', '9', 3 }, { '2', '1', '0', 3 }, { '2', '1', '1', 3 }, { '2', '1', '2', 3 }, { '2', '1', '3', 3 }, { '2', '1', '4', 3 }, { '2', '1', '5', 3 },
+    { '2', '1', '6', 3 }, { '2', '1', '7', 3 }, { '2', '1', '8', 3 }, { '2', '1', '9', 3 }, { '2', '2', '0', 3 }, { '2', '2', '1', 3 }, { '2', '2', '2', 3 }, { '2', '2', '3', 3 },
+    { '2', '2', '4', 3 }, { '2', '2', '5', 3 }, { '2', '2', '6', 3 }, { '2', '2', '7', 3 }, { '2', '2', '8', 3 }, { '2', '2', '9', 3 }, { '2', '3', '0', 3 }, { '2', '3', '1', 3 },
+    { '2', '3', '2', 3 }, { '2', '3', '3', 3 }, { '2', '3', '4', 3 }, { '2', '3', '5', 3 }, { '2', '3', '6', 3 }, { '2', '3', '7', 3 }, { '2', '3', '8', 3 }, { '2', '3', '9', 3 },
+    { '2', '4', '0', 3 }, { '2', '4', '1', 3 }, { '2', '4', '2', 3 }, { '2', '4', '3', 3 }, { '2', '4', '4', 3 }, { '2', '4', '5', 3 }, { '2', '4', '6', 3 }, { '2', '4', '7', 3 },
+    { '2', '4', '8', 3 }, { '2', '4', '9', 3 }, { '2', '5', '0', 3 }, { '2', '5', '1', 3 }, { '2', '5', '2', 3 }, { '2', '5', '3', 3 }, { '2', '5', '4', 3 }, { '2', '5', '5', 3 },
+};
+
+/**
+ * @brief 출력 버퍼에 최소 n 바이트의 여유 공간을 확보
+ * @details 여유가 없으면 2배로 늘리고, 최대 크기(_out_limit)에 도달했다면
+ * 지금까지의 내용을 먼저 출력한 뒤 버퍼를 비웁니다.
+ * @return 공간 확보 성공 여부 (메모리 부족 시 false)
+ */
+static bool _out_reserve( flush_ctx_t* ctx, size_t n )
+{
+    if( (size_t)( ctx->_end - ctx->_ptr ) >= n ) return true;
+
+    size_t used = (size_t)( ctx->_ptr - *ctx->_buf );
+
+    // 1. 최대 크기 도달 시 부분 출력 (Streaming)
+    if( ctx->_limit > 0 && *ctx->_cap >= ctx->_limit && used > 0 ){
+        cc_sink_write( ctx->_sink, *ctx->_buf, used );
+        ctx->_streamed += used;
+        ctx->_ptr = *ctx->_buf;
+        if( (size_t)( ctx->_end - ctx->_ptr ) >= n ) return true;
+        used = 0;
+    }
+
+    // 2. 기하급수적 확장
+    size_t new_cap = ( *ctx->_cap > 0 ) ? *ctx->_cap * 2 : CC_FLUSH_INIT_CAP;
+    while( new_cap < used + n ) new_cap *= 2;
+    if( ctx->_limit > 0 && new_cap > ctx->_limit ){
+        new_cap = ( ctx->_limit > used + n ) ? ctx->_limit : used + n;
+    }
+
+    char* new_buf = (char*)realloc( *ctx->_buf, new_cap );
+    if( !new_buf ) return false;
+
+    *ctx->_buf = new_buf;
+    *ctx->_cap = new_cap;
+    ctx->_ptr = new_buf + used;
+    ctx->_end = new_buf + new_cap;
+    return true;
+}
+
+/**
+ * @brief 출력 버퍼에 len 바이트를 덧붙임 (최대 크기가 있으면 나눠서 부분 출력)
+ * @return 성공 여부 (메모리 부족 시 false)
+ */
+static bool _out_append( flush_ctx_t* ctx, const char* data, size_t len )
+{
+    while( len > 0 ){
+        size_t piece = len;
+        if( ctx->_limit > 0 && piece > ctx->_limit / 2 ) piece = ctx->_limit / 2;
+        if( !_out_reserve( ctx, piece ) ) return false;
+
+        memcpy( ctx->_ptr, data, piece );
+        ctx->_ptr += piece;
+        data      += piece;
+        len       -= piece;
+    }
+    return true;
+}
+
+/**
+ * @brief flush 컨텍스트 초기화 (커서/색상은 "모름" 상태에서 시작)
+ * @details 초기값을 불가능한 좌표로 설정하여 첫 그리기 시 무조건 커서 이동 명령이 발생하게 합니다.
+ */
+static void _init_ctx( flush_ctx_t* ctx, const cc_buffer_t* self, char** buf, size_t* cap, size_t limit )
+{
+    ctx->_buf        = buf;
+    ctx->_cap        = cap;
+    ctx->_limit      = limit;
+    ctx->_ptr        = *buf;
+    ctx->_end        = *buf + *cap;
+    ctx->_cursor_x   = -1;
+    ctx->_cursor_y   = -1;
+    ctx->_fg         = CC_SGR_UNKNOWN;
+    ctx->_bg         = CC_SGR_UNKNOWN;
+    ctx->_color_mode = self->_color_mode;
+    ctx->_caps       = self->_term_caps;
+    ctx->_streamed   = 0;
+    ctx->_sink       = ( self->_sink ) ? self->_sink : cc_sink_stdout();
+}
+
+/**
+ * @brief 10진수 자릿수
+ */
+static int _digits( int n )
+{
+    int d = 1;
+    while( n >= 10 ){ n /= 10; ++d; }
+    return d;
+}
+
+/**
+ * @brief 양의 정수를 10진수로 출력
+ */
+static void _put_uint( flush_ctx_t* ctx, int n )
+{
+    char tmp[12];
+    int len = 0;
+    do { tmp[len++] = (char)( '0' + n % 10 ); n /= 10; } while( n > 0 );
+    while( len > 0 ) *ctx->_ptr++ = tmp[--len];
+}
+
+/**
+ * @brief 파라미터 1개짜리 CSI 시퀀스 출력 (n == 1 이면 기본값이므로 생략)
+ */
+static void _put_csi_n( flush_ctx_t* ctx, int n, char final )
+{
+    *ctx->_ptr++ = '\033';
+    *ctx->_ptr++ = '[';
+    if( n != 1 ) _put_uint( ctx, n );
+    *ctx->_ptr++ = final;
+}
+
+/**
+ * @brief _put_csi_n 의 출력 바이트 수
+ */
+static int _csi_n_cost( int n )
+{
+    return ( n == 1 ) ? 3 : 3 + _digits( n );
+}
+
+/**
+ * @brief 커서 위치 예약어 (CUP) 출력 바이트 수: \033[row;colH (col 1이면 ;col 생략)
+ */
+static int _cup_cost( int row, int col )
+{
+    if( row == 1 && col == 1 ) return 3;
+    return 3 + _digits( row ) + ( ( col > 1 ) ? 1 + _digits( col ) : 0 );
+}
+
+/**
+ * @brief 0~255 값을 10진수로 출력 (테이블 조회)
+ */
+static void _put_u8( flush_ctx_t* ctx, uint32_t v )
+{
+    const char* dec = _DEC_TABLE[v & 0xFF];
+    memcpy( ctx->_ptr, dec, 3 );
+    ctx->_ptr += dec[3];
+}
+
+/**
+ * @brief 셀 색상을 출력 색상 모드에 맞게 변환
+ * @details 256/16색 모드에서는 RGB를 팔레트 인덱스(CC_SGR_TYPE_INDEX)로 바꿉니다.
+ * 변환 후 값으로 비교하므로, 같은 인덱스로 모이는 RGB 사이에서는 SGR을 다시 보내지 않습니다.
+ */
+static uint32_t _resolve_color( const flush_ctx_t* ctx, uint32_t color )
+{
+    if( ctx->_color_mode == CC_COLOR_MODE_TRUECOLOR ) return color;
+    if( ( color >> CC_CELL_TYPE_SHIFT ) != CC_COLOR_TYPE_RGB ) return color;
+
+    cc_rgb_t rgb = { (uint8_t)( color >> 16 ), (uint8_t)( color >> 8 ), (uint8_t)color };
+    return ( CC_SGR_TYPE_INDEX << CC_CELL_TYPE_SHIFT ) | cc_color_quantize( &rgb, ctx->_color_mode );
+}
+
+/**
+ * @brief 색상이 기본색이 아닌 구체적인 색인지 (리셋 후 다시 지정해야 하는지) 확인
+ */
+static bool _is_explicit_color( uint32_t color )
+{
+    uint32_t type = color >> CC_CELL_TYPE_SHIFT;
+    return type == CC_COLOR_TYPE_RGB || type == CC_SGR_TYPE_INDEX;
+}
+
+/**
+ * @brief 색상의 SGR 파라미터 출력 바이트 수 (base: '3' = 글자색, '4' = 배경색)
+ * @details "39", "31", "91", "101", "38;5;N", "38;2;R;G;B"
+ */
+static int _sgr_color_cost( uint32_t color, char base )
+{
+    uint32_t type = color >> CC_CELL_TYPE_SHIFT;
+    if( type == CC_SGR_TYPE_INDEX ){
+        uint32_t index = color & 0xFF;
+        if( index < 8 )  return 2;
+        if( index < 16 ) return ( base == '4' ) ? 3 : 2; // 10X / 9X
+        return 5 + _DEC_TABLE[index][3];
+    }
+    if( type != CC_COLOR_TYPE_RGB ) return 2;
+    return 7 + _DEC_TABLE[( color >> 16 ) & 0xFF][3]
+             + _DEC_TABLE[( color >> 8 ) & 0xFF][3]
+             + _DEC_TABLE[color & 0xFF][3];
+}
+
+/**
+ * @brief 색상의 SGR 파라미터 출력 (base: '3' = 글자색, '4' = 배경색)
+ */
+static void _put_sgr_color( flush_ctx_t* ctx, uint32_t color, char base )
+{
+    uint32_t type = color >> CC_CELL_TYPE_SHIFT;
+
+    if( type == CC_SGR_TYPE_INDEX ){
+        uint32_t index = color & 0xFF;
+        if( index < 8 ){
+            // 30~37 / 40~47
+            *ctx->_ptr++ = base;
+            *ctx->_ptr++ = (char)( '0' + index );
+        }
+        else if( index < 16 ){
+            // 90~97 / 100~107 (밝은 색)
+            if( base == '4' ){ *ctx->_ptr++ = '1'; *ctx->_ptr++ = '0'; }
+            else             { *ctx->_ptr++ = '9'; }
+            *ctx->_ptr++ = (char)( '0' + index - 8 );
+        }
+        else{
+            // 38;5;N / 48;5;N
+            *ctx->_ptr++ = base;
+            memcpy( ctx->_ptr, "8;5;", 4 );
+            ctx->_ptr += 4;
+            _put_u8( ctx, index );
+        }
+        return;
+    }
+
+    *ctx->_ptr++ = base;
+    if( type != CC_COLOR_TYPE_RGB ){
+        *ctx->_ptr++ = '9'; // 39 / 49 : 기본색
+        return;
+    }
+    memcpy( ctx->_ptr, "8;2;", 4 );
+    ctx->_ptr += 4;
+    _put_u8( ctx, color >> 16 );
+    *ctx->_ptr++ = ';';
+    _put_u8( ctx, color >> 8 );
+    *ctx->_ptr++ = ';';
+    _put_u8( ctx, color );
+}
+
+/**
+ * @brief 글자색/배경색을 하나의 SGR 시퀀스로 출력 (바뀐 색만, 가장 짧은 형태로)
+ * @details 인자는 _resolve_color 로 변환된 값이어야 합니다.
+ * - 둘 다 바뀌면 "\033[38;2;..;48;2;..m" 한 번으로 보냅니다.
+ * - 기본색(RESET)은 39/49를 쓰되, "0"(전체 리셋) 후 나머지를 다시 지정하는 편이
+ *   더 짧으면 그쪽을 선택합니다.
+ * - NONE 타입은 "상관없음"으로 보고 현재 터미널 색을 유지합니다.
+ */
+static void _emit_sgr( flush_ctx_t* ctx, uint32_t fg, uint32_t bg )
+{
+    bool set_fg = ( fg >> CC_CELL_TYPE_SHIFT ) != CC_COLOR_TYPE_NONE && fg != ctx->_fg;
+    bool set_bg = ( bg >> CC_CELL_TYPE_SHIFT ) != CC_COLOR_TYPE_NONE && bg != ctx->_bg;
+    if( !set_fg && !set_bg ) return;
+
+    // 출력 후 터미널 상태
+    uint32_t next_fg = set_fg ? fg : ctx->_fg;
+    uint32_t next_bg = set_bg ? bg : ctx->_bg;
+    bool fg_rgb = _is_explicit_color( next_fg );
+    bool bg_rgb = _is_explicit_color( next_bg );
+
+    // A. 일반 형태: 바뀐 색만 지정
+    int cost_plain = ( set_fg ? _sgr_color_cost( fg, '3' ) : 0 )
+                   + ( set_bg ? _sgr_color_cost( bg, '4' ) : 0 )
+                   + ( ( set_fg && set_bg ) ? 1 : 0 );
+
+    // B. 리셋 형태: "0" 후 구체적인 색(RGB/팔레트)만 다시 지정 (기본색/모름은 0으로 해결)
+    bool reset_useful = ( set_fg && !fg_rgb ) || ( set_bg && !bg_rgb );
+    int  cost_reset   = 1 + ( fg_rgb ? 1 + _sgr_color_cost( next_fg, '3' ) : 0 )
+                          + ( bg_rgb ? 1 + _sgr_color_cost( next_bg, '4' ) : 0 );
+
+    *ctx->_ptr++ = '\033';
+    *ctx->_ptr++ = '[';
+
+    if( reset_useful && cost_reset < cost_plain ){
+        *ctx->_ptr++ = '0';
+        if( fg_rgb ){ *ctx->_ptr++ = ';'; _put_sgr_color( ctx, next_fg, '3' ); }
+        if( bg_rgb ){ *ctx->_ptr++ = ';'; _put_sgr_color( ctx, next_bg, '4' ); }
+
+        ctx->_fg = fg_rgb ? next_fg : ( (uint32_t)CC_COLOR_TYPE_RESET << CC_CELL_TYPE_SHIFT );
+        ctx->_bg = bg_rgb ? next_bg : ( (uint32_t)CC_COLOR_TYPE_RESET << CC_CELL_TYPE_SHIFT );
+    }
+    else{
+        if( set_fg ) _put_sgr_color( ctx, fg, '3' );
+        if( set_fg && set_bg ) *ctx->_ptr++ = ';';
+        if( set_bg ) _put_sgr_color( ctx, bg, '4' );
+
+        ctx->_fg = next_fg;
+        ctx->_bg = next_bg;
+    }
+
+    *ctx->_ptr++ = 'm';
+}
+
+/**
+ * @brief 같은 행에서 커서를 [from_x, to_x) 만큼 옮기는 대신 변하지 않은 셀을 다시 출력할 때의 비용
+ * @details 현재 색상 상태로 그려도 결과가 같은 셀만 허용합니다. (limit 이상이면 중단)
+ * @return 출력 바이트 수, 다시 출력할 수 없으면 INT_MAX
+ */
+static int _reemit_cost( const flush_ctx_t* ctx, const cc_cell_t* back_row, int from_x, int to_x, int limit )
+{
+    int cost = 0;
+    for( int x = from_x; x < to_x; ++x ){
+        const cc_cell_t* cell = &back_row[x];
+        uint32_t glyph = CELL_GLYPH( cell );
+        bool     is_trail = ( CELL_FLAGS( cell ) & CC_CELL_FLAG_WIDE_TRAIL ) != 0;
+
+        // Trail로 시작하거나, 결합 문자 등 커서 추적이 어긋날 수 있는 셀은 불가
+        if( is_trail && x == from_x ) return INT_MAX;
+        if( is_trail ) continue;
+        if( CC_GLYPH_IS_CLUSTER( glyph ) ) return INT_MAX;
+
+        int width = cc_glyph_width( glyph );
+        if( width == 0 || x + width > to_x ) return INT_MAX;
+
+        // 배경색은 반드시 같아야 하고, 글자색은 공백이 아닐 때만 비교
+        if( _resolve_color( ctx, cell->_bg ) != ctx->_bg ) return INT_MAX;
+        if( glyph != ' ' && _resolve_color( ctx, cell->_fg ) != ctx->_fg ) return INT_MAX;
+
+        cost += cc_glyph_byte_length( glyph );
+        if( cost >= limit ) return INT_MAX;
+    }
+    return cost;
+}
+
+/**
+ * @brief 커서를 (x, y) (0-based)로 옮기는 가장 짧은 바이트 시퀀스를 선택하여 출력
+ * @details 후보: 절대 이동(CUP), 같은 행 상대 이동(CUF/CUB), CR(+LF) 후 CUF,
+ * 그리고 사이에 있는 변하지 않은 셀을 그대로 다시 출력하는 방법.
+ * 커서가 행 끝을 넘은 상태(Pending Wrap)에서는 터미널마다 동작이 달라 상대 이동을 쓰지 않습니다.
+ */
+static void _move_cursor( flush_ctx_t* ctx, const cc_cell_t* back_row, int width, int x, int y )
+{
+    int row = y + 1;
+    int col = x + 1;
+    int cur_x = ctx->_cursor_x;
+    int cur_y = ctx->_cursor_y;
+
+    if( cur_y == row && cur_x == col ) return;
+
+    enum { MOVE_CUP, MOVE_CUF, MOVE_CUB, MOVE_CR, MOVE_CRLF, MOVE_REEMIT } best = MOVE_CUP;
+    int best_cost = _cup_cost( row, col );
+    int cuf_after_cr = ( col > 1 ) ? _csi_n_cost( col - 1 ) : 0;
+
+    bool known   = ( cur_y > 0 && cur_x > 0 );
+    bool in_line = known && cur_x <= width; // Pending Wrap 아님
+
+    if( known && cur_y == row ){
+        // 1. CR + CUF (Pending Wrap 상태에서도 CR은 안전)
+        if( 1 + cuf_after_cr < best_cost ){ best = MOVE_CR; best_cost = 1 + cuf_after_cr; }
+
+        if( in_line && col > cur_x ){
+            // 2. CUF
+            int cost = _csi_n_cost( col - cur_x );
+            if( cost < best_cost ){ best = MOVE_CUF; best_cost = cost; }
+
+            // 3. 변하지 않은 셀 다시 출력
+            cost = _reemit_cost( ctx, back_row, cur_x - 1, x, best_cost );
+            if( cost < best_cost ){ best = MOVE_REEMIT; best_cost = cost; }
+        }
+        else if( in_line && col < cur_x ){
+            // 4. CUB
+            int cost = _csi_n_cost( cur_x - col );
+            if( cost < best_cost ){ best = MOVE_CUB; best_cost = cost; }
+        }
+    }
+    else if( known && row > cur_y ){
+        // 5. CR + LF x N (+ CUF). LF만 쓰면 ONLCR 설정에 따라 열이 달라지므로 항상 CR을 먼저 보냄
+        int cost = 1 + ( row - cur_y ) + cuf_after_cr;
+        if( cost < best_cost ){ best = MOVE_CRLF; best_cost = cost; }
+    }
+
+    switch( best ){
+        case MOVE_CUP:
+            *ctx->_ptr++ = '\033';
+            *ctx->_ptr++ = '[';
+            if( row != 1 || col != 1 ) _put_uint( ctx, row );
+            if( col != 1 ){ *ctx->_ptr++ = ';'; _put_uint( ctx, col ); }
+            *ctx->_ptr++ = 'H';
+            break;
+        case MOVE_CUF:
+            _put_csi_n( ctx, col - cur_x, 'C' );
+            break;
+        case MOVE_CUB:
+            _put_csi_n( ctx, cur_x - col, 'D' );
+            break;
+        case MOVE_CRLF:
+        case MOVE_CR:
+            *ctx->_ptr++ = '\r';
+            for( int i = cur_y; best == MOVE_CRLF && i < row; ++i ) *ctx->_ptr++ = '\n';
+            if( col > 1 ) _put_csi_n( ctx, col - 1, 'C' );
+            break;
+        case MOVE_REEMIT:
+            for( int i = cur_x - 1; i < x; ++i ){
+                if( CELL_FLAGS( &back_row[i] ) & CC_CELL_FLAG_WIDE_TRAIL ) continue;
+                ctx->_ptr += cc_glyph_encode( CELL_GLYPH( &back_row[i] ), ctx->_ptr );
+            }
+            break;
+    }
+
+    ctx->_cursor_x = col;
+    ctx->_cursor_y = row;
+}
+
+/**
+ * @brief from 부터 이어지는 공백 셀 중 배경색(변환 후)이 bg 인 셀 개수 (to 미만까지)
+ */
+static int _blank_run( const flush_ctx_t* ctx, const cc_cell_t* back_row, int from, int to, uint32_t bg )
+{
+    int x = from;
+    while( x < to && back_row[x]._glyph == ' ' && _resolve_color( ctx, back_row[x]._bg ) == bg ){
+        ++x;
+    }
+    return x - from;
+}
+
+/**
+ * @brief from 부터 이어지는 셀 중 cell 과 같은 모양(글리프/변환 후 색상)인 셀 개수 (to 미만까지)
+ */
+static int _repeat_run( const flush_ctx_t* ctx, const cc_cell_t* back_row, int from, int to, const cc_cell_t* cell )
+{
+    uint32_t fg = _resolve_color( ctx, cell->_fg );
+    uint32_t bg = _resolve_color( ctx, cell->_bg );
+
+    int x = from;
+    while( x < to && back_row[x]._glyph == cell->_glyph
+                  && _resolve_color( ctx, back_row[x]._fg ) == fg
+                  && _resolve_color( ctx, back_row[x]._bg ) == bg ){
+        ++x;
+    }
+    return x - from;
+}
+
+/**
+ * @brief 변경된 셀 구간 [start, end)를 ANSI 시퀀스로 인코딩
+ * @details 구간 안의 모든 셀은 Front와 다르다는 것이 보장됩니다.
+ * 같은 배경색의 공백 구간은 ECH/EL, 같은 문자 구간은 REP으로 압축합니다. (_caps 에 따라)
+ * @return Front에 반영할 수 있는 구간의 끝 (EL로 행 끝까지 지운 경우 width), 출력 버퍼 확보 실패 시 -1
+ */
+static int _encode_run( flush_ctx_t* ctx, const cc_cell_t* back_row, int width, int y, int start, int end )
+{
+    for( int x = start; x < end; ++x ){
+        const cc_cell_t* back = &back_row[x];
+
+        // A. Wide char Trail 스킵
+        // (한글 등 2칸 문자 뒤에 오는 더미 데이터는 그리지 않음. Front 동기화는 구간 단위로 수행)
+        if( CELL_FLAGS( back ) & CC_CELL_FLAG_WIDE_TRAIL ){
+            continue;
+        }
+
+        if( !_out_reserve( ctx, CC_FLUSH_CELL_MAX ) ) return -1;
+
+        // B. 커서 이동 최적화 (가장 짧은 이동 시퀀스 선택)
+        _move_cursor( ctx, back_row, width, x, y );
+
+        // C. 색상 변경 최적화 (Stateful)
+        // 이전 문자와 색상이 다를 때만 SGR 시퀀스 전송 (글자색/배경색 통합)
+        _emit_sgr( ctx, _resolve_color( ctx, back->_fg ), _resolve_color( ctx, back->_bg ) );
+
+        // D. 공백 구간 지우기 (ECH/EL, 커서는 움직이지 않음)
+        if( back->_glyph == ' ' && ( ctx->_caps & ( CC_TERM_CAP_ECH | CC_TERM_CAP_EL ) ) ){
+            uint32_t bg    = _resolve_color( ctx, back->_bg );
+            int      blank = _blank_run( ctx, back_row, x, width, bg );
+
+            // D-1. 행 끝까지 공백이면 EL 한 번으로 끝냄 (구간 밖의 공백도 함께 반영)
+            if( ( ctx->_caps & CC_TERM_CAP_EL ) && x + blank == width && end - x > 3 ){
+                memcpy( ctx->_ptr, "\033[K", 3 );
+                ctx->_ptr += 3;
+                return width;
+            }
+
+            // D-2. 구간 안의 공백은 ECH (뒤에 이어질 커서 이동 비용까지 고려)
+            int count = ( blank < end - x ) ? blank : end - x;
+            int cost  = _csi_n_cost( count ) + ( ( x + count < end ) ? _csi_n_cost( count ) : 0 );
+            if( ( ctx->_caps & CC_TERM_CAP_ECH ) && cost < count ){
+                _put_csi_n( ctx, count, 'X' );
+                x += count - 1;
+                continue;
+            }
+        }
+
+        // E. 문자 출력
+        uint32_t glyph = CELL_GLYPH( back );
+        int      bytes = cc_glyph_encode( glyph, ctx->_ptr );
+        ctx->_ptr += bytes;
+
+        // F. 커서 위치 추적 업데이트
+        // 문자 너비만큼 x 좌표 증가 (한글이면 +2, 영문이면 +1, 결합 문자는 등록 시 계산한 너비)
+        int cw = cc_glyph_width( glyph );
+        ctx->_cursor_x += cw;
+
+        // G. 같은 문자 반복 (REP, 코드포인트 하나로 된 1칸 문자만. 결합 문자는 터미널마다 반복 대상이 다름)
+        if( ( ctx->_caps & CC_TERM_CAP_REP ) && cw == 1 && !CC_GLYPH_IS_CLUSTER( glyph ) ){
+            int repeat = _repeat_run( ctx, back_row, x + 1, end, back );
+            if( repeat > 0 && _csi_n_cost( repeat ) < repeat * bytes ){
+                _put_csi_n( ctx, repeat, 'b' );
+                ctx->_cursor_x += repeat;
+                x += repeat;
+            }
+        }
+    }
+    return end;
+}
+
+/**
+ * @brief 스크롤 영역 지정(DECSTBM) 후 SU/SD로 [top, bottom] 행을 dy행 이동
+ * @details DECSTBM은 커서를 (1, 1)로 보내므로 커서 위치를 갱신합니다.
+ * @return 성공 여부 (출력 버퍼 확보 실패 시 false)
+ */
+static bool _emit_scroll( flush_ctx_t* ctx, int top, int bottom, int dy )
+{
+    if( !_out_reserve( ctx, CC_FLUSH_CELL_MAX ) ) return false;
+
+    *ctx->_ptr++ = '\033';
+    *ctx->_ptr++ = '[';
+    _put_uint( ctx, top + 1 );
+    *ctx->_ptr++ = ';';
+    _put_uint( ctx, bottom + 1 );
+    *ctx->_ptr++ = 'r';
+
+    // SU(S): 내용을 위로, SD(T): 내용을 아래로
+    _put_csi_n( ctx, ( dy < 0 ) ? -dy : dy, ( dy < 0 ) ? 'S' : 'T' );
+
+    ctx->_cursor_x = 1;
+    ctx->_cursor_y = 1;
+    return true;
+}
+
+/**
+ * @brief 한 행의 해시 (FNV-1a, 32비트 단위)
+ */
+static uint64_t _hash_row( const cc_cell_t* row, int width )
+{
+    const uint32_t* words = (const uint32_t*)row;
+    size_t          count = (size_t)width * ( sizeof( cc_cell_t ) / sizeof( uint32_t ) );
+
+    uint64_t hash = 0xCBF29CE484222325ull;
+    for( size_t i = 0; i < count; ++i ){
+        hash = ( hash ^ words[i] ) * 0x100000001B3ull;
+    }
+    return hash;
+}
+
+/**
+ * @brief Back의 행들이 Front의 행들을 k행 옮긴 것과 같은 구간을 찾아 스크롤로 처리
+ * @details 변경된 행마다 해시가 같은 Front 행을 가까운 순으로 찾아 연속 구간으로 늘려보고,
+ * (다시 그리지 않아도 되는 행 수 - 스크롤로 새로 드러나 다시 그려야 하는 행 수)가
+ * 가장 큰 구간 하나를 선택합니다. 선택되면 Front를 옮기고 스크롤 시퀀스를 출력합니다.
+ */
+static void _detect_scroll( cc_buffer_t* self, flush_ctx_t* ctx )
+{
+    int       width  = self->_width;
+    int       height = self->_height;
+    uint64_t* front_hash = self->_row_hashes;
+    uint64_t* back_hash  = self->_row_hashes + height;
+
+    // 1. 행 해시 계산 (변경되지 않은 행은 Back == Front 이므로 Front 해시 재사용)
+    int dirty_count = 0;
+    for( int y = 0; y < height; ++y ){
+        front_hash[y] = _hash_row( &self->_front_buffer[INDEX( self, 0, y )], width );
+        if( ( self->_dirty_rows[y >> 6] >> ( y & 63 ) ) & 1 ){
+            back_hash[y] = _hash_row( &self->_back_buffer[INDEX( self, 0, y )], width );
+            ++dirty_count;
+        } else {
+            back_hash[y] = front_hash[y];
+        }
+    }
+    if( dirty_count < CC_SCROLL_DETECT_MIN ) return;
+
+    // 2. 이득이 가장 큰 이동 구간 탐색 (Back 행 [start, start + len) == Front 행 [start + k, ...))
+    int best_start = 0, best_len = 0, best_k = 0;
+    int best_score = CC_SCROLL_DETECT_MIN - 1;
+
+    for( int y = 0; y < height; ++y ){
+        if( back_hash[y] == front_hash[y] ) continue;
+
+        int candidates = 0;
+        for( int d = 1; d < height && candidates < CC_SCROLL_CANDIDATES; ++d ){
+            for( int sign = -1; sign <= 1; sign += 2 ){
+                int f = y + sign * d;
+                if( f < 0 || f >= height || front_hash[f] != back_hash[y] ) continue;
+                ++candidates;
+
+                int k   = f - y;
+                int len = 1;
+                while( y + len < height && y + len + k < height && back_hash[y + len] == front_hash[y + len + k] ){
+                    ++len;
+                }
+
+                // 이득: 구간 안에서 원래 다시 그려야 했던 행 수 - 새로 드러나는 행 중 원래 그대로였던 행 수
+                int score = 0;
+                for( int i = 0; i < len; ++i ){
+                    if( back_hash[y + i] != front_hash[y + i] ) ++score;
+                }
+                int exposed_top = ( k > 0 ) ? y + len : y + k;
+                for( int i = 0; i < ( k > 0 ? k : -k ); ++i ){
+                    if( back_hash[exposed_top + i] == front_hash[exposed_top + i] ) --score;
+                }
+
+                if( score > best_score ){
+                    best_score = score;
+                    best_start = y;
+                    best_len   = len;
+                    best_k     = k;
+                }
+            }
+        }
+    }
+    if( best_len == 0 ) return;
+
+    // 3. 해시 충돌 대비 실제 내용 확인
+    for( int i = 0; i < best_len; ++i ){
+        if( memcmp( &self->_back_buffer[INDEX( self, 0, best_start + i )],
+                    &self->_front_buffer[INDEX( self, 0, best_start + i + best_k )],
+                    sizeof( cc_cell_t ) * width ) != 0 ){
+            return;
+        }
+    }
+
+    // 4. 스크롤 영역 = 원래 위치 + 새 위치 (내용은 -k 행 이동)
+    int top    = ( best_k > 0 ) ? best_start : best_start + best_k;
+    int bottom = ( best_k > 0 ) ? best_start + best_len + best_k - 1 : best_start + best_len - 1;
+
+    if( _emit_scroll( ctx, top, bottom, -best_k ) ){
+        _shift_front( self, top, bottom, -best_k );
+    }
+}
+
+/**
+ * @brief 대기 중인 스크롤 명령과 자동 감지된 스크롤을 출력 (Front는 이미 이동된 상태)
+ * @return 스크롤 시퀀스를 출력했는지 여부
+ */
+static bool _flush_scroll( cc_buffer_t* self, flush_ctx_t* ctx )
+{
+    bool emitted = false;
+
+    for( int i = 0; i < self->_scroll_op_count; ++i ){
+        const cc_scroll_op_t* op = &self->_scroll_ops[i];
+        if( !_emit_scroll( ctx, op->_top, op->_bottom, op->_dy ) ){
+            // Front는 이미 이동했는데 터미널에 보내지 못했으므로 전체를 다시 그림
+            _invalidate_front( self );
+            self->_scroll_op_count = 0;
+            return false;
+        }
+        emitted = true;
+    }
+    self->_scroll_op_count = 0;
+
+    if( self->_scroll_detect ){
+        char* before = ctx->_ptr;
+        _detect_scroll( self, ctx );
+        emitted = emitted || ( ctx->_ptr != before );
+    }
+
+    // 스크롤 영역 해제 (커서는 (1, 1)로 이동)
+    if( emitted && _out_reserve( ctx, 3 ) ){
+        memcpy( ctx->_ptr, "\033[r", 3 );
+        ctx->_ptr += 3;
+        ctx->_cursor_x = 1;
+        ctx->_cursor_y = 1;
+    }
+    return emitted;
+}
+
+/**
+ * @brief y행의 [min_x, max_x] 범위에서 바뀐 셀 구간을 찾아 인코딩하고 Front에 반영
+ * @return 출력 버퍼 확보에 실패하여 반영하지 못한 첫 열 (성공 시 -1)
+ */
+static int _flush_row( cc_buffer_t* self, flush_ctx_t* ctx, int y, int min_x, int max_x )
+{
+    const cc_cell_t* back_row  = &self->_back_buffer[INDEX( self, 0, y )];
+    cc_cell_t*       front_row = &self->_front_buffer[INDEX( self, 0, y )];
+
+    int x   = min_x;
+    int end = max_x + 1;
+
+    while( x < end ){
+        // 1. 변경 구간 경계 탐색 (SIMD 커널)
+        int run_start = _diff_scan( front_row, back_row, x, end, false );
+        if( run_start >= end ) break;
+        int run_end = _diff_scan( front_row, back_row, run_start + 1, end, true );
+
+        // 2. 구간 인코딩 후 Front 동기화 (Commit)
+        // 출력 버퍼 확보에 실패하면 동기화하지 않고 다음 flush에서 다시 시도
+        int done = _encode_run( ctx, back_row, self->_width, y, run_start, run_end );
+        if( done < 0 ) return run_start;
+        memcpy( &front_row[run_start], &back_row[run_start], sizeof( cc_cell_t ) * ( done - run_start ) );
+
+        x = done;
+    }
+    return -1;
+}
+
+// -----------------------------------------------------------------------------
+// Parallel Flush (Row Bands)
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief 병렬 flush의 행 작업 (변경된 행 하나)
+ */
+typedef struct
+{
+    int _y;      /**< 행 */
+    int _min_x;  /**< 비교 시작 열 */
+    int _max_x;  /**< 비교 끝 열 (포함) */
+    int _fail_x; /**< 출력 버퍼 확보에 실패한 열 (-1 = 성공) */
+} flush_job_t;
+
+/**
+ * @brief 연속된 행 작업 묶음(Band)과 그 출력 조각
+ * @details 조각은 항상 절대 커서 이동(CUP)과 전체 SGR로 시작하므로
+ * 다른 조각의 끝 상태와 무관하게 순서대로 이어 붙일 수 있습니다.
+ */
+typedef struct
+{
+    struct cc_flush_pool_s* _pool;
+    int    _first; /**< 첫 작업 인덱스 */
+    int    _last;  /**< 마지막 작업 다음 인덱스 */
+    char*  _buf;   /**< 출력 조각 (프레임마다 재사용) */
+    size_t _cap;   /**< 출력 조각 크기 */
+    size_t _len;   /**< 이번 프레임에 인코딩된 길이 */
+} flush_band_t;
+
+/**
+ * @brief 병렬 flush 스레드 풀
+ * @details 밴드 0은 flush를 호출한 스레드가, 나머지는 워커 스레드가 하나씩 맡습니다.
+ */
+struct cc_flush_pool_s
+{
+    cc_buffer_t*    _owner;
+    int             _band_count; /**< 밴드 수 (워커 수 + 1) */
+    pthread_t*      _threads;    /**< 워커 스레드 (_band_count - 1 개) */
+    flush_band_t*   _bands;
+    flush_job_t*    _jobs;
+    int             _job_cap;
+
+    pthread_mutex_t _mtx;
+    pthread_cond_t  _start_cond; /**< 새 작업 세대 시작 알림 */
+    pthread_cond_t  _done_cond;  /**< 모든 워커 완료 알림 */
+    unsigned        _generation; /**< 작업 세대 (증가하면 워커가 시작) */
+    int             _busy;       /**< 아직 끝나지 않은 워커 수 */
+    bool            _quit;
+};
+
+/**
+ * @brief 밴드 하나의 행 작업을 자신의 출력 조각으로 인코딩
+ */
+static void _encode_band( flush_band_t* band )
+{
+    cc_buffer_t* self = band->_pool->_owner;
+    flush_ctx_t  ctx;
+    _init_ctx( &ctx, self, &band->_buf, &band->_cap, 0 );
+
+    for( int i = band->_first; i < band->_last; ++i ){
+        flush_job_t* job = &band->_pool->_jobs[i];
+        job->_fail_x = _flush_row( self, &ctx, job->_y, job->_min_x, job->_max_x );
+    }
+    band->_len = (size_t)( ctx._ptr - band->_buf );
+}
+
+/**
+ * @brief 워커 스레드: 새 세대가 시작될 때마다 자기 밴드를 인코딩
+ */
+static void* _flush_worker( void* arg )
+{
+    flush_band_t*           band = (flush_band_t*)arg;
+    struct cc_flush_pool_s* pool = band->_pool;
+    unsigned                seen = 0;
+
+    pthread_mutex_lock( &pool->_mtx );
+    while( true ){
+        while( !pool->_quit && pool->_generation == seen ){
+            pthread_cond_wait( &pool->_start_cond, &pool->_mtx );
+        }
+        if( pool->_quit ) break;
+        seen = pool->_generation;
+
+        pthread_mutex_unlock( &pool->_mtx );
+        _encode_band( band );
+        pthread_mutex_lock( &pool->_mtx );
+
+        if( --pool->_busy == 0 ){
+            pthread_cond_signal( &pool->_done_cond );
+        }
+    }
+    pthread_mutex_unlock( &pool->_mtx );
+    return NULL;
+}
+
+/**
+ * @brief 스레드 풀 종료 및 해제
+ */
+static void _pool_destroy( struct cc_flush_pool_s* pool )
+{
+    if( !pool ) return;
+
+    pthread_mutex_lock( &pool->_mtx );
+    pool->_quit = true;
+    pthread_cond_broadcast( &pool->_start_cond );
+    pthread_mutex_unlock( &pool->_mtx );
+
+    for( int i = 0; i < pool->_band_count - 1; ++i ){
+        pthread_join( pool->_threads[i], NULL );
+    }
+    for( int i = 0; i < pool->_band_count; ++i ){
+        free( pool->_bands[i]._buf );
+    }
+
+    pthread_cond_destroy( &pool->_done_cond );
+    pthread_cond_destroy( &pool->_start_cond );
+    pthread_mutex_destroy( &pool->_mtx );
+    free( pool->_jobs );
+    free( pool->_bands );
+    free( pool->_threads );
+    free( pool );
+}
+
+/**
+ * @brief threads 개(호출 스레드 포함)의 밴드를 처리하는 스레드 풀 생성
+ * @return 생성된 풀 (워커를 하나도 만들지 못하면 NULL)
+ */
+static struct cc_flush_pool_s* _pool_create( cc_buffer_t* self, int threads )
+{
+    struct cc_flush_pool_s* pool = (struct cc_flush_pool_s*)calloc( 1, sizeof( struct cc_flush_pool_s ) );
+    if( !pool ) return NULL;
+
+    pool->_owner   = self;
+    pool->_threads = (pthread_t*)calloc( (size_t)threads - 1, sizeof( pthread_t ) );
+    pool->_bands   = (flush_band_t*)calloc( (size_t)threads, sizeof( flush_band_t ) );
+    if( !pool->_threads || !pool->_bands ){
+        free( pool->_threads );
+        free( pool->_bands );
+        free( pool );
+        return NULL;
+    }
+
+    pthread_mutex_init( &pool->_mtx, NULL );
+    pthread_cond_init( &pool->_start_cond, NULL );
+    pthread_cond_init( &pool->_done_cond, NULL );
+
+    for( int i = 0; i < threads; ++i ){
+        pool->_bands[i]._pool = pool;
+    }
+
+    // 워커 생성 (일부만 성공하면 그 수만큼만 사용)
+    pool->_band_count = 1;
+    for( int i = 0; i < threads - 1; ++i ){
+        if( pthread_create( &pool->_threads[i], NULL, _flush_worker, &pool->_bands[i + 1] ) != 0 ) break;
+        pool->_band_count++;
+    }
+
+    if( pool->_band_count < 2 ){
+        _pool_destroy( pool );
+        return NULL;
+    }
+    return pool;
+}
+
+/**
+ * @brief 변경된 행들을 밴드로 나눠 병렬 인코딩한 뒤 순서대로 ctx에 이어 붙임
+ * @details 밴드는 비교할 셀 수가 비슷하도록 나눕니다. Front 행은 밴드끼리 겹치지 않으므로
+ * 잠금 없이 동기화되며, 변경 기록(비트맵)은 호출 스레드만 수정합니다.
+ * @return 성공 여부 (작업 배열 할당 실패 시 false, 변경 기록은 그대로 남음)
+ */
+static bool _flush_parallel( cc_buffer_t* self, flush_ctx_t* ctx )
+{
+    struct cc_flush_pool_s* pool = self->_flush_pool;
+
+    if( pool->_job_cap < self->_height ){
+        flush_job_t* jobs = (flush_job_t*)realloc( pool->_jobs, sizeof( flush_job_t ) * self->_height );
+        if( !jobs ) return false;
+        pool->_jobs    = jobs;
+        pool->_job_cap = self->_height;
+    }
+
+    // 1. 변경된 행 수집 (변경 기록은 여기서 비움)
+    int    job_count   = 0;
+    size_t total_cells = 0;
+    size_t words = ( (size_t)self->_height + 63 ) / 64;
+    for( size_t word = 0; word < words; ++word ){
+        uint64_t bits = self->_dirty_rows[word];
+        self->_dirty_rows[word] = 0;
+
+        while( bits ){
+            int y = (int)( word * 64 ) + __builtin_ctzll( bits );
+            bits &= bits - 1;
+
+            flush_job_t* job = &pool->_jobs[job_count++];
+            job->_y     = y;
+            job->_min_x = self->_dirty_spans[y]._min_x;
+            job->_max_x = self->_dirty_spans[y]._max_x;
+            total_cells += (size_t)( job->_max_x - job->_min_x + 1 );
+
+            self->_dirty_spans[y]._min_x = INT_MAX;
+            self->_dirty_spans[y]._max_x = -1;
+        }
+    }
+
+    // 2. 셀 수 기준으로 밴드 분할
+    int    band = 0;
+    size_t acc  = 0;
+    pool->_bands[0]._first = 0;
+    for( int i = 0; i < job_count; ++i ){
+        acc += (size_t)( pool->_jobs[i]._max_x - pool->_jobs[i]._min_x + 1 );
+        if( band < pool->_band_count - 1 && acc * pool->_band_count >= total_cells * ( band + 1 ) ){
+            pool->_bands[band]._last = i + 1;
+            pool->_bands[++band]._first = i + 1;
+        }
+    }
+    pool->_bands[band]._last = job_count;
+    for( int i = band + 1; i < pool->_band_count; ++i ){
+        pool->_bands[i]._first = job_count;
+        pool->_bands[i]._last  = job_count;
+    }
+
+    // 3. 워커 시작 + 호출 스레드는 밴드 0 처리 후 대기
+    pthread_mutex_lock( &pool->_mtx );
+    pool->_busy = pool->_band_count - 1;
+    pool->_generation++;
+    pthread_cond_broadcast( &pool->_start_cond );
+    pthread_mutex_unlock( &pool->_mtx );
+
+    _encode_band( &pool->_bands[0] );
+
+    pthread_mutex_lock( &pool->_mtx );
+    while( pool->_busy > 0 ){
+        pthread_cond_wait( &pool->_done_cond, &pool->_mtx );
+    }
+    pthread_mutex_unlock( &pool->_mtx );
+
+    // 4. 실패한 행은 다음 flush에서 다시 시도
+    for( int i = 0; i < job_count; ++i ){
+        flush_job_t* job = &pool->_jobs[i];
+        if( job->_fail_x >= 0 ) _mark_dirty( self, job->_y, job->_fail_x, job->_max_x );
+    }
+
+    // 5. 조각을 순서대로 이어 붙임 (각 조각이 커서/색상을 새로 지정하므로 이후 상태는 모름)
+    for( int i = 0; i < pool->_band_count; ++i ){
+        if( !_out_append( ctx, pool->_bands[i]._buf, pool->_bands[i]._len ) ){
+            // 이어 붙이지 못한 조각은 Front에만 반영되었으므로 전체를 다시 그림
+            _invalidate_front( self );
+            break;
+        }
+    }
+    ctx->_cursor_x = -1;
+    ctx->_cursor_y = -1;
+    ctx->_fg       = CC_SGR_UNKNOWN;
+    ctx->_bg       = CC_SGR_UNKNOWN;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+// Async Writer
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief 프레임이 갱신한 행 범위 (프레임을 버릴 때 다시 그릴 범위)
+ */
+typedef struct
+{
+    int _y;
+    int _min_x;
+    int _max_x;
+} frame_row_t;
+
+/**
+ * @brief 인코딩된 프레임 하나 (출력 바이트 + 그 프레임이 Front에 반영한 범위)
+ */
+typedef struct
+{
+    char*        _data;
+    size_t       _cap;
+    size_t       _len;       /**< 출력할 길이 (0 = 빈 슬롯) */
+    frame_row_t* _rows;      /**< 갱신한 행 범위 목록 */
+    int          _row_count;
+    int          _row_cap;
+    bool         _full;      /**< 행 범위로 나타낼 수 없는 변경(스크롤 등) 포함 여부 */
+} out_frame_t;
+
+#define CC_WRITER_CLOSE_TIMEOUT_MS 500 /**< 출력 스레드 종료 시 남은 프레임 전송을 기다리는 최대 시간 */
+
+/**
+ * @brief 비동기 출력 스레드
+ * @details 프레임은 build(UI 스레드가 인코딩) → pending(대기 슬롯) → current(전송 중) 순서로
+ * 버퍼째 교환되므로 복사하지 않습니다. 대기 슬롯은 한 칸이라 전송이 밀리면 새 프레임이
+ * 아직 한 바이트도 보내지 않은 이전 프레임을 대체합니다.
+ */
+struct cc_writer_s
+{
+    cc_sink_t*      _sink;       /**< 출력 Sink (_mtx 보호, 버퍼의 Sink 또는 _tty_sink) */
+    cc_sink_t*      _tty_sink;   /**< 터미널을 Non-blocking으로 따로 연 fd Sink (소유, 필요할 때 생성) */
+    pthread_t       _thread;
+    out_frame_t     _build;      /**< UI 스레드가 인코딩 중인 프레임 */
+    out_frame_t     _pending;    /**< 전송 대기 프레임 */
+    out_frame_t     _current;    /**< 전송 중인 프레임 (출력 스레드 소유) */
+    cc_sink_t*      _active;     /**< _current 를 보내고 있는 Sink (종료 시 막힌 쓰기를 중단할 대상) */
+    bool            _busy;       /**< _current 전송 중 */
+    bool            _quit;
+    bool            _done;       /**< 출력 스레드 종료됨 */
+
+    pthread_mutex_t _mtx;
+    pthread_cond_t  _ready_cond; /**< 새 프레임 / 종료 알림 */
+    pthread_cond_t  _idle_cond;  /**< 전송 완료 알림 */
+};
+
+/**
+ * @brief 프레임이 y행 [min_x, max_x] 를 갱신했음을 기록 (기록 실패 시 전체 갱신으로 간주)
+ */
+static void _frame_note_row( out_frame_t* frame, int y, int min_x, int max_x )
+{
+    if( frame->_full ) return;
+
+    if( frame->_row_count == frame->_row_cap ){
+        int          new_cap = ( frame->_row_cap > 0 ) ? frame->_row_cap * 2 : 64;
+        frame_row_t* rows    = (frame_row_t*)realloc( frame->_rows, sizeof( frame_row_t ) * new_cap );
+        if( !rows ){
+            frame->_full = true;
+            return;
+        }
+        frame->_rows    = rows;
+        frame->_row_cap = new_cap;
+    }
+
+    frame_row_t* row = &frame->_rows[frame->_row_count++];
+    row->_y     = y;
+    row->_min_x = min_x;
+    row->_max_x = max_x;
+}
+
+/**
+ * @brief 프레임을 빈 슬롯으로 되돌림 (버퍼는 재사용)
+ */
+static void _frame_reset( out_frame_t* frame )
+{
+    frame->_len       = 0;
+    frame->_row_count = 0;
+    frame->_full      = false;
+}
+
+static void _frame_swap( out_frame_t* lhs, out_frame_t* rhs )
+{
+    out_frame_t tmp = *lhs;
+    *lhs = *rhs;
+    *rhs = tmp;
+}
+
+static void _frame_free( out_frame_t* frame )
+{
+    free( frame->_data );
+    free( frame->_rows );
+}
+
+/**
+ * @brief 출력 스레드: 대기 프레임을 가져와 끝까지 전송 (종료 요청 시에도 남은 프레임은 보냄)
+ */
+static void* _writer_main( void* arg )
+{
+    struct cc_writer_s* w = (struct cc_writer_s*)arg;
+
+    pthread_mutex_lock( &w->_mtx );
+    while( true ){
+        while( !w->_quit && w->_pending._len == 0 ){
+            pthread_cond_wait( &w->_ready_cond, &w->_mtx );
+        }
+        if( w->_pending._len == 0 ) break;
+
+        // 대기 프레임을 전송 중으로 (이 시점부터는 버릴 수 없음)
+        _frame_swap( &w->_current, &w->_pending );
+        _frame_reset( &w->_pending );
+        w->_busy = true;
+        w->_active = w->_sink;
+        pthread_mutex_unlock( &w->_mtx );
+
+        if( cc_sink_write( w->_active, w->_current._data, w->_current._len ) ) cc_sink_flush( w->_active );
+
+        pthread_mutex_lock( &w->_mtx );
+        _frame_reset( &w->_current );
+        w->_busy = false;
+        pthread_cond_broadcast( &w->_idle_cond );
+    }
+    w->_done = true;
+    pthread_cond_broadcast( &w->_idle_cond );
+    pthread_mutex_unlock( &w->_mtx );
+    return NULL;
+}
+
+/**
+ * @brief 대기 중이거나 전송 중인 프레임이 모두 터미널로 나갈 때까지 대기
+ */
+static void _writer_drain( struct cc_writer_s* w )
+{
+    pthread_mutex_lock( &w->_mtx );
+    while( w->_busy || w->_pending._len > 0 ){
+        pthread_cond_wait( &w->_idle_cond, &w->_mtx );
+    }
+    pthread_mutex_unlock( &w->_mtx );
+}
+
+/**
+ * @brief 남은 프레임을 보낸 뒤 출력 스레드 종료 및 해제
+ * @details 터미널이 출력을 받지 않아 CC_WRITER_CLOSE_TIMEOUT_MS 안에 끝나지 않으면
+ * 막힌 쓰기를 중단시키고 남은 프레임은 버립니다. (멈춘 터미널 때문에 종료가 멈추지 않도록)
+ */
+static void _writer_destroy( struct cc_writer_s* w )
+{
+    if( !w ) return;
+
+    struct timespec deadline;
+    clock_gettime( CLOCK_REALTIME, &deadline );
+    deadline.tv_sec  += CC_WRITER_CLOSE_TIMEOUT_MS / 1000;
+    deadline.tv_nsec += ( CC_WRITER_CLOSE_TIMEOUT_MS % 1000 ) * 1000000L;
+    if( deadline.tv_nsec >= 1000000000L ){
+        deadline.tv_sec  += 1;
+        deadline.tv_nsec -= 1000000000L;
+    }
+
+    pthread_mutex_lock( &w->_mtx );
+    w->_quit = true;
+    pthread_cond_signal( &w->_ready_cond );
+    while( !w->_done ){
+        if( pthread_cond_timedwait( &w->_idle_cond, &w->_mtx, &deadline ) == ETIMEDOUT ) break;
+    }
+
+    // 시간 안에 끝나지 않음: 보내지 않은 프레임은 버리고 막힌 쓰기 중단
+    cc_sink_t* stalled = ( !w->_done && w->_busy ) ? w->_active : NULL;
+    if( stalled ){
+        _frame_reset( &w->_pending );
+        cc_sink_interrupt( stalled, true );
+    }
+    pthread_mutex_unlock( &w->_mtx );
+    pthread_join( w->_thread, NULL );
+
+    // 버퍼가 빌려 쓴 Sink는 계속 쓸 수 있도록 되돌림
+    if( stalled ) cc_sink_interrupt( stalled, false );
+
+    cc_sink_destroy( w->_tty_sink );
+    _frame_free( &w->_build );
+    _frame_free( &w->_pending );
+    _frame_free( &w->_current );
+
+    pthread_cond_destroy( &w->_idle_cond );
+    pthread_cond_destroy( &w->_ready_cond );
+    pthread_mutex_destroy( &w->_mtx );
+    free( w );
+}
+
+/**
+ * @brief 출력 스레드가 쓸 터미널 Sink 생성
+ * @details 표준 출력이 터미널이면 같은 장치를 Non-blocking으로 새로 엽니다.
+ * (표준 출력 fd에 O_NONBLOCK을 걸면 같은 파일 설명을 공유하는 표준 입력까지 바뀌므로)
+ * 터미널이 아니면(파이프, 파일) 표준 출력을 복제하여 그대로 씁니다.
+ * @return 생성된 Sink (실패 시 NULL)
+ */
+static cc_sink_t* _open_tty_sink( void )
+{
+    const char* tty = isatty( STDOUT_FILENO ) ? ttyname( STDOUT_FILENO ) : NULL;
+    int fd = ( tty ) ? open( tty, O_WRONLY | O_NONBLOCK | O_NOCTTY | O_CLOEXEC ) : -1;
+    if( fd < 0 ) fd = dup( STDOUT_FILENO );
+    if( fd < 0 ) return NULL;
+
+    cc_sink_t* sink = cc_sink_create_fd( fd, true );
+    if( !sink ) close( fd );
+    return sink;
+}
+
+/**
+ * @brief 출력 스레드가 다음 프레임부터 쓸 Sink를 바꿈 (전송 중인 프레임은 이전 Sink로 끝까지 보냄)
+ * @param sink 버퍼에 지정된 Sink (NULL = 표준 출력 터미널)
+ * @return 성공 여부 (터미널 Sink를 만들지 못하면 false, 이전 Sink 유지)
+ */
+static bool _writer_set_sink( struct cc_writer_s* w, cc_sink_t* sink )
+{
+    if( !sink ){
+        if( !w->_tty_sink ) w->_tty_sink = _open_tty_sink();
+        if( !w->_tty_sink ) return false;
+        sink = w->_tty_sink;
+    }
+
+    pthread_mutex_lock( &w->_mtx );
+    w->_sink = sink;
+    pthread_mutex_unlock( &w->_mtx );
+    return true;
+}
+
+/**
+ * @brief 출력 스레드 생성
+ * @param sink 버퍼에 지정된 Sink (NULL = 표준 출력 터미널)
+ * @return 생성된 출력 스레드 (실패 시 NULL)
+ */
+static struct cc_writer_s* _writer_create( cc_sink_t* sink )
+{
+    struct cc_writer_s* w = (struct cc_writer_s*)calloc( 1, sizeof( struct cc_writer_s ) );
+    if( !w ) return NULL;
+
+    pthread_mutex_init( &w->_mtx, NULL );
+    pthread_cond_init( &w->_ready_cond, NULL );
+    pthread_cond_init( &w->_idle_cond, NULL );
+
+    if( !_writer_set_sink( w, sink ) || pthread_create( &w->_thread, NULL, _writer_main, w ) != 0 ){
+        pthread_cond_destroy( &w->_idle_cond );
+        pthread_cond_destroy( &w->_ready_cond );
+        pthread_mutex_destroy( &w->_mtx );
+        cc_sink_destroy( w->_tty_sink );
+        free( w );
+        return NULL;
+    }
+    return w;
+}
+
+/**
+ * @brief 아직 전송을 시작하지 않은 대기 프레임을 회수하여 버림
+ * @details 버린 프레임의 내용은 이미 Front에 반영되어 있으므로, 그 프레임이 갱신한 범위의
+ * Front를 무효화하여 이번 flush가 실제로 전송된 화면 기준으로 다시 비교하게 합니다.
+ * (2칸 문자가 범위 경계에 걸칠 수 있으므로 양옆 1칸 포함)
+ */
+static void _writer_reclaim( cc_buffer_t* self )
+{
+    struct cc_writer_s* w       = self->_writer;
+    cc_cell_t           invalid = { CC_CELL_GLYPH_INVALID, 0, 0 };
+
+    pthread_mutex_lock( &w->_mtx );
+    if( w->_pending._len > 0 ){
+        if( w->_pending._full ){
+            _invalidate_front( self );
+        }
+        else{
+            for( int i = 0; i < w->_pending._row_count; ++i ){
+                const frame_row_t* row = &w->_pending._rows[i];
+                if( row->_y >= self->_height ) continue;
+
+                int x0 = ( row->_min_x > 0 ) ? row->_min_x - 1 : 0;
+                int x1 = ( row->_max_x < self->_width - 1 ) ? row->_max_x + 1 : self->_width - 1;
+                if( x0 > x1 ) continue;
+                _fill_rect( self->_front_buffer, self->_width, x0, row->_y, x1 - x0 + 1, 1, invalid );
+                _mark_dirty( self, row->_y, x0, x1 );
+            }
+        }
+        _frame_reset( &w->_pending );
+    }
+    pthread_mutex_unlock( &w->_mtx );
+}
+
+/**
+ * @brief 인코딩이 끝난 build 프레임을 대기 슬롯에 넣고 출력 스레드를 깨움
+ * @details 대기 슬롯은 flush 시작 시 _writer_reclaim 으로 비워져 있으므로 교환만 합니다.
+ */
+static void _writer_submit( struct cc_writer_s* w, size_t len )
+{
+    w->_build._len = len;
+
+    pthread_mutex_lock( &w->_mtx );
+    _frame_swap( &w->_build, &w->_pending );
+    pthread_cond_signal( &w->_ready_cond );
+    pthread_mutex_unlock( &w->_mtx );
+
+    _frame_reset( &w->_build );
+}
+
+// -----------------------------------------------------------------------------
+// Damage Rects
+// -----------------------------------------------------------------------------
+
+static cc_rect_t _rect_union( cc_rect_t a, cc_rect_t b )
+{
+    int x0 = ( a._x < b._x ) ? a._x : b._x;
+    int y0 = ( a._y < b._y ) ? a._y : b._y;
+    int x1 = ( a._x + a._w > b._x + b._w ) ? a._x + a._w : b._x + b._w;
+    int y1 = ( a._y + a._h > b._y + b._h ) ? a._y + a._h : b._y + b._h;
+    return cc_rect_make( x0, y0, x1 - x0, y1 - y0 );
+}
+
+static long _rect_area( cc_rect_t r )
+{
+    return (long)r._w * r._h;
+}
+
+/**
+ * @brief 두 사각형을 합치면 늘어나는 면적 (겹치는 부분은 중복 계산되지 않도록 합집합 기준)
+ */
+static long _merge_cost( cc_rect_t a, cc_rect_t b )
+{
+    cc_rect_t overlap = cc_rect_intersect( a, b );
+    long covered = _rect_area( a ) + _rect_area( b ) - ( cc_rect_is_empty( overlap ) ? 0 : _rect_area( overlap ) );
+    return _rect_area( _rect_union( a, b ) ) - covered;
+}
+
+/**
+ * @brief i, j 번 사각형을 합쳐 i에 두고 j는 마지막 사각형으로 메움
+ */
+static void _merge_rects( cc_rect_t* rects, int* count, int i, int j )
+{
+    rects[i] = _rect_union( rects[i], rects[j] );
+    rects[j] = rects[--( *count )];
+}
+
+/**
+ * @brief 겹치는 사각형이 없어질 때까지 합침
+ */
+static void _merge_overlaps( cc_rect_t* rects, int* count )
+{
+    bool merged = true;
+    while( merged ){
+        merged = false;
+        for( int i = 0; i < *count && !merged; ++i ){
+            for( int j = i + 1; j < *count; ++j ){
+                if( !cc_rect_is_empty( cc_rect_intersect( rects[i], rects[j] ) ) ){
+                    _merge_rects( rects, count, i, j );
+                    merged = true;
+                    break;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief 마지막(이번 행에서 새로 생긴) 사각형을 합쳤을 때 늘어나는 면적이 가장 작은 사각형에 합침
+ * @details 기존 사각형끼리는 이미 고른 결과이므로 새 사각형과의 쌍만 비교합니다. (행마다 O(count))
+ */
+static void _reduce_last_rect( cc_rect_t* rects, int* count )
+{
+    int  last   = *count - 1;
+    int  best_j = 0;
+    long best   = LONG_MAX;
+    for( int j = 0; j < last; ++j ){
+        long cost = _merge_cost( rects[j], rects[last] );
+        if( cost < best ){
+            best   = cost;
+            best_j = j;
+        }
+    }
+    _merge_rects( rects, count, best_j, last );
+}
+
+// -----------------------------------------------------------------------------
+// Clipped Drawing
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief 박스 테두리 글자 위치 (g_box_glyphs 의 열)
+ */
+enum { CC_BOX_H, CC_BOX_V, CC_BOX_TL, CC_BOX_TR, CC_BOX_BL, CC_BOX_BR, CC_BOX_PARTS };
+
+/**
+ * @brief 스타일별 테두리 글리프 (모두 코드포인트 하나, 1칸이므로 글리프 ID로 바로 사용)
+ */
+static const uint32_t g_box_glyphs[CC_BOX_STYLE_COUNT][CC_BOX_PARTS] = {
+    [CC_BOX_STYLE_HEAVY]   = { 0x2501, 0x2503, 0x250F, 0x2513, 0x2517, 0x251B }, // ━ ┃ ┏ ┓ ┗ ┛
+    [CC_BOX_STYLE_LIGHT]   = { 0x2500, 0x2502, 0x250C, 0x2510, 0x2514, 0x2518 }, // ─ │ ┌ ┐ └ ┘
+    [CC_BOX_STYLE_DOUBLE]  = { 0x2550, 0x2551, 0x2554, 0x2557, 0x255A, 0x255D }, // ═ ║ ╔ ╗ ╚ ╝
+    [CC_BOX_STYLE_ROUNDED] = { 0x2500, 0x2502, 0x256D, 0x256E, 0x2570, 0x256F }, // ─ │ ╭ ╮ ╰ ╯
+};
+
+/**
+ * @brief 영역(버퍼 범위 안으로 잘린)을 공백으로 채움
+ */
+static void _fill_area( cc_buffer_t* self, cc_rect_t area, cc_cell_t value )
+{
+    if( cc_rect_is_empty( area ) ) return;
+
+    // 2칸 문자는 한 칸 단위로 채울 수 없으므로 공백으로
+    if( ( value._glyph >> CC_CELL_FLAG_SHIFT ) || cc_glyph_width( value._glyph ) != 1 ) value._glyph = ' ';
+
+    // 영역 경계에 걸친 2칸 문자는 바깥쪽 절반도 공백으로 정리 (변경 범위에 양옆 1칸 포함)
+    for( int y = area._y; y < area._y + area._h; ++y ){
+        _break_wide_pair( self, area._x, y, area._w );
+        _mark_dirty( self, y, area._x - 1, area._x + area._w );
+    }
+    _fill_rect( self->_back_buffer, self->_width, area._x, area._y, area._w, area._h, value );
+}
+
+static void _clear_area( cc_buffer_t* self, cc_rect_t area, const cc_color_t* bg_color )
+{
+    cc_cell_t blank;
+    blank._glyph = ' ';
+    blank._fg    = _pack_color( &CC_COLOR_WHITE );
+    blank._bg    = _pack_color( ( bg_color ) ? bg_color : &CC_COLOR_BLACK );
+
+    _fill_area( self, area, blank );
+}
+
+/**
+ * @brief 영역 셀의 배경색만 바꿈 (글자/글자색 유지, 그림자용)
+ */
+static void _shade_area( cc_buffer_t* self, cc_rect_t area, uint32_t packed_bg )
+{
+    if( cc_rect_is_empty( area ) ) return;
+
+    for( int y = area._y; y < area._y + area._h; ++y ){
+        cc_cell_t* row = &self->_back_buffer[INDEX( self, 0, y )];
+        for( int x = area._x; x < area._x + area._w; ++x ){
+            row[x]._bg = packed_bg;
+        }
+        _mark_dirty( self, y, area._x, area._x + area._w - 1 );
+    }
+}
+
+/**
+ * @brief 문자열을 clip 영역 (버퍼 범위 안) 안에만 그림
+ * @details 보이지 않는 행이면 바로 반환하고, 왼쪽 밖의 글자는 기록 없이 건너뛰며, 오른쪽 경계에서 멈춤
+ */
+static void _draw_string_in( cc_buffer_t* self, const cc_rect_t* clip, int x, int y, const char* text, const cc_color_t* fg, const cc_color_t* bg )
+{
+    if( y < clip->_y || y >= clip->_y + clip->_h ) return;
+
+    int left  = clip->_x;
+    int right = clip->_x + clip->_w;
+    if( x >= right ) return;
+
+    int cursor_x = x;
+    int start_x  = -1;
+    size_t i = 0;
+
+    // 안전한 디폴트 색상 (문자열 단위로 한 번만 압축)
+    uint32_t packed_fg = _pack_color( ( fg ) ? fg : &CC_COLOR_WHITE );
+    uint32_t packed_bg = _pack_color( ( bg ) ? bg : &CC_COLOR_BLACK );
+
+    while( text[i] != '\0' && cursor_x < right ){
+        // 0. ASCII Fast Path
+        // ASCII는 모두 1칸이므로 디코딩/너비 계산 없이 구간 단위로 바로 기록 (첫 비ASCII 바이트에서 아래로)
+        if( (unsigned char)text[i] < 0x80 ){
+            // 영역 왼쪽 밖 부분은 건너뜀
+            while( cursor_x < left && text[i] != '\0' && (unsigned char)text[i] < 0x80 ){
+                cursor_x++;
+                i++;
+            }
+            if( cursor_x < left || text[i] == '\0' ) continue;
+
+            int run = 0;
+            int room = right - cursor_x;
+            while( run < room && text[i + run] != '\0' && (unsigned char)text[i + run] < 0x80 ){
+                run++;
+            }
+
+            // 뒤에 결합 문자가 붙을 수 있으므로 비ASCII 앞의 마지막 글자는 아래에서 처리
+            if( run < room && (unsigned char)text[i + run] >= 0x80 ) run--;
+
+            if( run > 0 ){
+                if( start_x < 0 ) start_x = cursor_x;
+                _break_wide_pair( self, cursor_x, y, run );
+
+                cc_cell_t* cell = &self->_back_buffer[INDEX( self, cursor_x, y )];
+                for( int k = 0; k < run; ++k ){
+                    cell[k]._glyph = (unsigned char)text[i + k];
+                    cell[k]._fg    = packed_fg;
+                    cell[k]._bg    = packed_bg;
+                }
+
+                cursor_x += run;
+                i += (size_t)run;
+                continue;
+            }
+        }
+
+        // 1. Grapheme Cluster Decode (결합 문자/ZWJ 시퀀스는 글리프 ID 하나로 등록)
+        uint32_t glyph = 0;
+        int char_len = cc_glyph_decode( &text[i], &glyph );
+
+        // 2. Visual Width Calculation
+        int visual_width = cc_glyph_width( glyph );
+
+        // 앞 글자 없이 홀로 온 결합 문자는 표시하지 않음
+        if( visual_width == 0 ){
+            i += char_len;
+            continue;
+        }
+
+        // 오른쪽 끝에 걸친 2칸 문자는 터미널 줄바꿈(스크롤)이나 영역 침범을 유발하므로 공백으로 대체
+        if( visual_width == 2 && cursor_x + 1 >= right ){
+            glyph        = ' ';
+            visual_width = 1;
+        }
+
+        // 3. Draw to Back Buffer
+        if( cursor_x >= left ){
+            if( start_x < 0 ) start_x = cursor_x;
+
+            cc_cell_t* cell = &self->_back_buffer[INDEX( self, cursor_x, y )];
+            _break_wide_pair( self, cursor_x, y, visual_width );
+
+            cell->_glyph = glyph;
+            cell->_fg    = packed_fg;
+            cell->_bg    = packed_bg;
+
+            // Wide char 처리 (한글 등 2칸 문자)
+            if( visual_width == 2 ){
+                cc_cell_t* trail = cell + 1;
+
+                trail->_glyph = CC_CELL_FLAG_WIDE_TRAIL << CC_CELL_FLAG_SHIFT; // 빈 문자
+                trail->_fg    = packed_fg;
+                trail->_bg    = packed_bg;
+            }
+        }
+
+        cursor_x += visual_width;
+        i += char_len;
+    }
+
+    // 4. 변경 범위 기록 (2칸 문자 정리로 바뀐 양옆 1칸 포함)
+    if( start_x >= 0 ){
+        _mark_dirty( self, y, start_x - 1, cursor_x );
+    }
+}
 
 /**
- * @brief UTF-8 첫 바이트를 보고 전체 바이트 길이를 반환
+ * @brief 셀 배열을 clip 영역 안에만 복사
+ * @details 잘린 경계에서 짝을 잃은 Lead/Trail은 공백으로 바꿉니다.
  */
-static int _get_utf8_len( char c )
+static void _write_cells_in( cc_buffer_t* self, const cc_rect_t* clip, int x, int y, const cc_cell_t* cells, int count )
 {
-    if( ( c & 0x80 ) == 0 ) return 1;
-    if( ( c & 0xE0 ) == 0xC0 ) return 2;
-    if( ( c & 0xF0 ) == 0xE0 ) return 3;
-    if( ( c & 0xF8 ) == 0xF0 ) return 4;
-    return 1; // Fallback
+    if( y < clip->_y || y >= clip->_y + clip->_h ) return;
+
+    int from = ( x > clip->_x ) ? x : clip->_x;
+    int to   = ( x + count < clip->_x + clip->_w ) ? x + count : clip->_x + clip->_w;
+    if( from >= to ) return;
+
+    const cc_cell_t* first = &cells[from - x];
+    const cc_cell_t* last  = &cells[to - 1 - x];
+    bool cut_trail = ( CELL_FLAGS( first ) & CC_CELL_FLAG_WIDE_TRAIL ) != 0;
+    bool cut_lead  = !( CELL_FLAGS( last ) & CC_CELL_FLAG_WIDE_TRAIL ) && cc_glyph_width( CELL_GLYPH( last ) ) == 2;
+
+    // 내용이 같으면 변경 범위를 늘리지 않음 (매 프레임 같은 캔버스를 복사하는 경우)
+    cc_cell_t* row = &self->_back_buffer[INDEX( self, 0, y )];
+    if( !cut_trail && !cut_lead && memcmp( &row[from], first, sizeof( cc_cell_t ) * ( to - from ) ) == 0 ) return;
+
+    _break_wide_pair( self, from, y, to - from );
+    memmove( &row[from], first, sizeof( cc_cell_t ) * ( to - from ) );
+
+    // 첫 칸의 Trail, 마지막 칸의 Lead는 짝이 복사되지 않았으므로 공백으로
+    if( cut_trail ) row[from]._glyph = ' ';
+    if( cut_lead ) row[to - 1]._glyph = ' ';
+
+    _mark_dirty( self, y, from - 1, to );
 }
 
 /**
- * @brief 두 Cell이 동일한지 비교
+ * @brief src 의 src_rect 영역을 (x, y)에 clip 영역 안에만 복사
+ * @details 같은 버퍼 안의 복사는 한 행씩 임시 버퍼를 거쳐 원본이 덮이기 전에 읽습니다.
  */
-static bool _is_cell_equal( const cc_cell_t* lhs, const cc_cell_t* rhs )
+static void _blit_in( cc_buffer_t* self, const cc_rect_t* clip, int x, int y, const cc_buffer_t* src, cc_rect_t src_rect )
 {
-    // 1. 문자열 비교 (고정 5바이트)
-    if( strcmp( lhs->_ch, rhs->_ch ) != 0 ){
-        return false;
+    // 원본 범위를 벗어난 부분은 잘라내고 대상 위치도 같이 이동
+    cc_rect_t bounds = { 0, 0, src->_width, src->_height };
+    cc_rect_t area   = cc_rect_intersect( src_rect, bounds );
+    if( cc_rect_is_empty( area ) ) return;
+    x += area._x - src_rect._x;
+    y += area._y - src_rect._y;
+
+    // 대상 Clip으로 복사할 행 범위 제한
+    int row_from = ( y > clip->_y ) ? 0 : clip->_y - y;
+    int row_to   = ( y + area._h < clip->_y + clip->_h ) ? area._h : clip->_y + clip->_h - y;
+    if( row_from >= row_to ) return;
+
+    cc_cell_t* tmp = NULL;
+    if( src == self ){
+        tmp = (cc_cell_t*)malloc( sizeof( cc_cell_t ) * area._w );
+        if( !tmp ) return;
     }
-    // 2. 색상 비교
-    if( !cc_color_is_equal( &lhs->_fg, &rhs->_fg ) ){
-        return false;
+
+    // 같은 버퍼에서 아래로 옮기면 아래 행부터 복사
+    bool bottom_up = ( src == self && y > area._y );
+    for( int i = 0; i < row_to - row_from; ++i ){
+        int r = bottom_up ? row_to - 1 - i : row_from + i;
+        const cc_cell_t* cells = &src->_back_buffer[INDEX( src, area._x, area._y + r )];
+        if( tmp ){
+            memcpy( tmp, cells, sizeof( cc_cell_t ) * area._w );
+            cells = tmp;
+        }
+        _write_cells_in( self, clip, x, y + r, cells, area._w );
     }
-    if( !cc_color_is_equal( &lhs->_bg, &rhs->_bg ) ){
-        return false;
+
+    free( tmp );
+}
+
+/**
+ * @brief 박스를 clip 영역 안에만 그림 (변/내부/그림자를 사각 영역 단위로 채움)
+ * @param border_fg 선 색상
+ * @param fill_fg 내부 공백의 글자색
+ * @param shadow 그림자 배경색 (NULL = 그림자 없음)
+ */
+static void _draw_frame_in( cc_buffer_t* self, const cc_rect_t* clip, cc_rect_t box, cc_box_style_e style,
+                            const cc_color_t* border_fg, const cc_color_t* fill_fg, const cc_color_t* bg, const cc_color_t* shadow )
+{
+    if( cc_rect_is_empty( box ) ) return;
+    if( (unsigned)style >= CC_BOX_STYLE_COUNT ) style = CC_BOX_STYLE_HEAVY;
+
+    int x = box._x, y = box._y, w = box._w, h = box._h;
+
+    if( shadow ){
+        uint32_t shade = _pack_color( shadow );
+        _shade_area( self, cc_rect_intersect( cc_rect_make( x + w, y + 1, 2, h ), *clip ), shade );
+        _shade_area( self, cc_rect_intersect( cc_rect_make( x + 2, y + h, w - 2, 1 ), *clip ), shade );
     }
-    // 3. Wide Trail 여부
-    if( lhs->_is_wide_trail != rhs->_is_wide_trail ){
-        return false;
+    if( cc_rect_is_empty( cc_rect_intersect( box, *clip ) ) ) return;
+
+    const uint32_t* g = g_box_glyphs[style];
+
+    cc_cell_t line;
+    line._fg = _pack_color( border_fg );
+    line._bg = _pack_color( ( bg ) ? bg : &CC_COLOR_BLACK );
+
+    cc_cell_t fill = line;
+    fill._glyph = ' ';
+    fill._fg    = _pack_color( ( fill_fg ) ? fill_fg : &CC_COLOR_WHITE );
+
+    // Fill Center
+    _fill_area( self, cc_rect_intersect( cc_rect_make( x + 1, y + 1, w - 2, h - 2 ), *clip ), fill );
+
+    // Horizontal Lines
+    line._glyph = g[CC_BOX_H];
+    _fill_area( self, cc_rect_intersect( cc_rect_make( x + 1, y, w - 2, 1 ), *clip ), line );
+    _fill_area( self, cc_rect_intersect( cc_rect_make( x + 1, y + h - 1, w - 2, 1 ), *clip ), line );
+
+    // Vertical Lines
+    line._glyph = g[CC_BOX_V];
+    _fill_area( self, cc_rect_intersect( cc_rect_make( x, y + 1, 1, h - 2 ), *clip ), line );
+    _fill_area( self, cc_rect_intersect( cc_rect_make( x + w - 1, y + 1, 1, h - 2 ), *clip ), line );
+
+    // Corners
+    static const int corner_at[4][2] = { { 0, 0 }, { 1, 0 }, { 0, 1 }, { 1, 1 } };
+    for( int i = 0; i < 4; ++i ){
+        line._glyph = g[CC_BOX_TL + i];
+        cc_rect_t at = cc_rect_make( x + corner_at[i][0] * ( w - 1 ), y + corner_at[i][1] * ( h - 1 ), 1, 1 );
+        _fill_area( self, cc_rect_intersect( at, *clip ), line );
     }
-    return true;
 }
 
 /**
- * @brief 내부 버퍼 초기화 (Resize, Clear 등에서 사용)
+ * @brief 기존 cc_buffer_draw_box 형식 (굵은 선, red_border 강조)
  */
-static void _fill_buffer( cc_cell_t* buffer, int count, const cc_color_t* bg )
+static void _draw_box_in( cc_buffer_t* self, const cc_rect_t* clip, int x, int y, int w, int h, const cc_color_t* fg, const cc_color_t* bg, bool red_border )
 {
-    for( int i = 0; i < count; ++i ){
-        strcpy( buffer[i]._ch, " " );
-        buffer[i]._fg = CC_COLOR_WHITE;
-        buffer[i]._bg = ( bg ) ? *bg : CC_COLOR_BLACK;
-        buffer[i]._is_wide_trail = false;
-    }
+    const cc_color_t* border_fg = ( red_border ) ? &CC_COLOR_RED : ( fg ? fg : &CC_COLOR_WHITE );
+    _draw_frame_in( self, clip, cc_rect_make( x, y, w, h ), CC_BOX_STYLE_HEAVY, border_fg, fg, bg, NULL );
+}
+
+/**
+ * @brief 뷰 Clip을 현재 버퍼 범위로 자름 (뷰 생성 후 버퍼 크기가 바뀌었을 수 있음)
+ * @return 그릴 수 있는 영역이 있으면 true
+ */
+static bool _view_clip( const cc_buffer_view_t* view, cc_rect_t* out_clip )
+{
+    if( !view || !view->_buffer || !view->_buffer->_back_buffer ) return false;
+
+    cc_rect_t bounds = { 0, 0, view->_buffer->_width, view->_buffer->_height };
+    *out_clip = cc_rect_intersect( view->_clip, bounds );
+    return !cc_rect_is_empty( *out_clip );
 }
 
 // -----------------------------------------------------------------------------
@@ -73,18 +2103,21 @@ cc_buffer_t* cc_buffer_create( int width, int height )
 {
     if( width <= 0 || height <= 0 ) return NULL;
 
-    cc_buffer_t* self = (cc_buffer_t*)malloc( sizeof( cc_buffer_t ) );
+    cc_buffer_t* self = (cc_buffer_t*)calloc( 1, sizeof( cc_buffer_t ) );
     if( !self ) return NULL;
 
-    self->_width  = width;
-    self->_height = height;
+    self->_width    = width;
+    self->_height   = height;
+    self->_capacity = width * height;
+
+    self->_term_caps = CC_TERM_CAPS_DEFAULT;
 
     size_t buf_size = sizeof( cc_cell_t ) * width * height;
 
     self->_front_buffer = (cc_cell_t*)malloc( buf_size );
     self->_back_buffer  = (cc_cell_t*)malloc( buf_size );
 
-    if( !self->_front_buffer || !self->_back_buffer ){
+    if( !self->_front_buffer || !self->_back_buffer || !_alloc_dirty( self, height, 0 ) ){
         cc_buffer_destroy( self ); // cleanup partial allocation
         return NULL;
     }
@@ -92,6 +2125,7 @@ cc_buffer_t* cc_buffer_create( int width, int height )
     // 초기화
     _fill_buffer( self->_front_buffer, width * height, &CC_COLOR_BLACK );
     _fill_buffer( self->_back_buffer, width * height, &CC_COLOR_BLACK );
+    _update_clip( self );
 
     return self;
 }
@@ -102,36 +2136,99 @@ void cc_buffer_destroy( cc_buffer_t* self )
 
     if( self->_front_buffer ) free( self->_front_buffer );
     if( self->_back_buffer )  free( self->_back_buffer );
+    if( self->_dirty_rows )   free( self->_dirty_rows );
+    if( self->_dirty_spans )  free( self->_dirty_spans );
+    if( self->_row_hashes )   free( self->_row_hashes );
+    if( self->_out_buf )      free( self->_out_buf );
+    _pool_destroy( self->_flush_pool );
+    _writer_destroy( self->_writer );
 
     free( self );
 }
 
 bool cc_buffer_resize( cc_buffer_t* self, int width, int height )
 {
-    if( !self ) return false;
+    if( !self || !self->_front_buffer || !self->_back_buffer ) return false;
+    if( width <= 0 || height <= 0 ) return false;
     if( self->_width == width && self->_height == height ) return true;
 
-    // 기존 버퍼 해제 후 재할당 (단순 realloc보다 안전하게 초기화하기 위함)
-    if( self->_front_buffer ) free( self->_front_buffer );
-    if( self->_back_buffer )  free( self->_back_buffer );
+    // 아직 보내지 않은 대기 프레임은 이전 크기 기준이므로 버림 (전송 중인 프레임은 기다리지 않음)
+    if( self->_writer ) _writer_reclaim( self );
+
+    int old_w  = self->_width;
+    int old_h  = self->_height;
+    int keep_w = ( width < old_w ) ? width : old_w;
+    int keep_h = ( height < old_h ) ? height : old_h;
+
+    // 1. 저장 공간 확보 (줄어들 때는 기존 공간 재사용, 늘어날 때만 realloc으로 확장)
+    // realloc은 기존 내용을 보존하므로 겹치는 영역을 다시 그리지 않아도 됨
+    int count = width * height;
+    if( count > self->_capacity ){
+        size_t     buf_size = sizeof( cc_cell_t ) * count;
+        cc_cell_t* front    = (cc_cell_t*)realloc( self->_front_buffer, buf_size );
+        if( !front ) return false;
+        self->_front_buffer = front;
+
+        cc_cell_t* back = (cc_cell_t*)realloc( self->_back_buffer, buf_size );
+        if( !back ) return false; // 기존 크기 그대로 유지 (Front만 여유 공간이 생김)
+        self->_back_buffer = back;
+        self->_capacity    = count;
+    }
 
-    self->_width  = width;
-    self->_height = height;
+    // 2. 잘리는 오른쪽 경계에 걸친 2칸 문자 정리
+    // Back은 공백으로 쪼개고, Front는 터미널이 어떻게 처리했을지 모르므로 무효화
+    if( width < old_w ){
+        for( int y = 0; y < keep_h; ++y ){
+            cc_cell_t* front_row = &self->_front_buffer[y * old_w];
+            cc_cell_t* back_row  = &self->_back_buffer[y * old_w];
+            if( CELL_FLAGS( &front_row[width] ) & CC_CELL_FLAG_WIDE_TRAIL ){
+                front_row[width - 1]._glyph = CC_CELL_GLYPH_INVALID;
+            }
+            _split_wide_at( back_row, old_w, width );
+        }
+    }
 
-    size_t buf_size = sizeof( cc_cell_t ) * width * height;
-    self->_front_buffer = (cc_cell_t*)malloc( buf_size );
-    self->_back_buffer  = (cc_cell_t*)malloc( buf_size );
+    // 3. 겹치는 영역을 새 너비의 행 배치로 옮김
+    _relayout_rows( self->_front_buffer, old_w, width, keep_h );
+    _relayout_rows( self->_back_buffer, old_w, width, keep_h );
 
-    if( !self->_front_buffer || !self->_back_buffer ){
-        // 메모리 할당 실패 시 객체 상태가 불안정하므로 최소한 NULL 처리
-        if( self->_front_buffer ) { free( self->_front_buffer ); self->_front_buffer = NULL; }
-        if( self->_back_buffer )  { free( self->_back_buffer );  self->_back_buffer = NULL; }
+    self->_width  = width;
+    self->_height = height;
+    _update_clip( self );
+
+    if( !_alloc_dirty( self, height, keep_h ) ){
+        // 변경 추적 배열을 만들지 못하면 flush가 동작하지 않으므로 객체를 비활성화
+        free( self->_front_buffer );
+        free( self->_back_buffer );
+        self->_front_buffer = NULL;
+        self->_back_buffer  = NULL;
+        self->_capacity     = 0;
         return false;
     }
 
-    // 화면 전체 갱신을 위해 초기화
-    _fill_buffer( self->_front_buffer, width * height, &CC_COLOR_BLACK );
-    _fill_buffer( self->_back_buffer, width * height, &CC_COLOR_BLACK );
+    // 4. 새로 드러난 영역만 초기화 (Back = 공백, Front = 무효 -> 다음 flush에서 출력)
+    cc_cell_t blank   = { ' ', _pack_color( &CC_COLOR_WHITE ), _pack_color( &CC_COLOR_BLACK ) };
+    cc_cell_t invalid = { CC_CELL_GLYPH_INVALID, 0, 0 };
+    if( width > old_w ){
+        _fill_rect( self->_back_buffer, width, old_w, 0, width - old_w, keep_h, blank );
+        _fill_rect( self->_front_buffer, width, old_w, 0, width - old_w, keep_h, invalid );
+    }
+    if( height > old_h ){
+        _fill_rect( self->_back_buffer, width, 0, old_h, width, height - old_h, blank );
+        _fill_rect( self->_front_buffer, width, 0, old_h, width, height - old_h, invalid );
+    }
+    for( int y = 0; y < height; ++y ){
+        int x0 = ( y < keep_h ) ? keep_w - 1 : 0; // 잘린 2칸 문자 자리 포함
+        _mark_dirty( self, y, x0, width - 1 );
+    }
+
+    // 5. 터미널이 겹치는 영역을 그대로 유지한다고 볼 수 없으면 전체를 다시 그림
+    // 대기 중인 스크롤 명령은 Front에만 반영되었으므로 마찬가지로 다시 그림
+    // 비동기 출력 중이면 전송 중인 프레임이 새 크기의 터미널에 어떻게 그려질지 모르므로 다시 그림
+    if( !( self->_term_caps & CC_TERM_CAP_RESIZE_KEEP ) || self->_scroll_op_count > 0 || self->_writer ){
+        _invalidate_front( self );
+    }
+    self->_scroll_op_count = 0;
 
     return true;
 }
@@ -142,200 +2239,530 @@ void cc_buffer_clear( cc_buffer_t* self, const cc_color_t* bg_color )
 
     int count = self->_width * self->_height;
     _fill_buffer( self->_back_buffer, count, bg_color );
+    _mark_all_dirty( self );
+}
+
+void cc_buffer_clear_rect( cc_buffer_t* self, const cc_rect_t* rect, const cc_color_t* bg_color )
+{
+    if( !self || !rect || !self->_back_buffer ) return;
+
+    _clear_area( self, cc_rect_intersect( *rect, self->_clip ), bg_color );
 }
 
 void cc_buffer_draw_string( cc_buffer_t* self, int x, int y, const char* text, const cc_color_t* fg, const cc_color_t* bg )
 {
     if( !self || !text ) return;
-    if( y < 0 || y >= self->_height ) return;
 
-    int cursor_x = x;
-    size_t i = 0;
-    size_t len = strlen( text );
+    _draw_string_in( self, &self->_clip, x, y, text, fg, bg );
+}
 
-    // 안전한 디폴트 색상
-    cc_color_t safe_fg = ( fg ) ? *fg : CC_COLOR_WHITE;
-    cc_color_t safe_bg = ( bg ) ? *bg : CC_COLOR_BLACK;
+void cc_cell_init( cc_cell_t* cell, uint32_t glyph, const cc_color_t* fg, const cc_color_t* bg )
+{
+    if( !cell ) return;
 
-    while( i < len && cursor_x < self->_width ){
-        // 1. UTF-8 Byte Length
-        int char_len = _get_utf8_len( text[i] );
+    cell->_glyph = glyph;
+    cell->_fg    = _pack_color( ( fg ) ? fg : &CC_COLOR_WHITE );
+    cell->_bg    = _pack_color( ( bg ) ? bg : &CC_COLOR_BLACK );
+}
 
-        // 2. Visual Width Calculation
-        // cc_util을 활용하여 코드포인트 추출 후 너비 계산
-        // (단순화를 위해 char copy 후 검사)
-        char temp_ch[5] = {0};
-        if( char_len > 4 ) char_len = 1; // Defensive check
-        memcpy( temp_ch, &text[i], char_len );
-        temp_ch[char_len] = '\0';
+void cc_buffer_write_cells( cc_buffer_t* self, int x, int y, const cc_cell_t* cells, int count )
+{
+    if( !self || !cells || count <= 0 ) return;
 
-        size_t visual_width = cc_util_get_string_width( temp_ch );
+    _write_cells_in( self, &self->_clip, x, y, cells, count );
+}
 
-        // 3. Draw to Back Buffer
-        if( cursor_x >= 0 && cursor_x < self->_width ){
-            int idx = INDEX( self, cursor_x, y );
-            cc_cell_t* cell = &self->_back_buffer[idx];
+void cc_buffer_fill_rect( cc_buffer_t* self, const cc_rect_t* rect, const cc_cell_t* cell )
+{
+    if( !self || !rect || !cell || !self->_back_buffer ) return;
+
+    _fill_area( self, cc_rect_intersect( *rect, self->_clip ), *cell );
+}
 
-            strcpy( cell->_ch, temp_ch );
-            cell->_fg = safe_fg;
-            cell->_bg = safe_bg;
-            cell->_is_wide_trail = false;
+void cc_buffer_draw_box_style( cc_buffer_t* self, const cc_rect_t* rect, cc_box_style_e style, const cc_color_t* fg, const cc_color_t* bg, const cc_color_t* shadow )
+{
+    if( !self || !rect || !self->_back_buffer ) return;
 
-            // Wide char 처리 (한글 등 2칸 문자)
-            if( visual_width == 2 && cursor_x + 1 < self->_width ){
-                int next_idx = INDEX( self, cursor_x + 1, y );
-                cc_cell_t* trail = &self->_back_buffer[next_idx];
-
-                strcpy( trail->_ch, "" ); // 빈 문자
-                trail->_fg = safe_fg;
-                trail->_bg = safe_bg;
-                trail->_is_wide_trail = true;
-            }
+    const cc_color_t* line_fg = ( fg ) ? fg : &CC_COLOR_WHITE;
+    _draw_frame_in( self, &self->_clip, *rect, style, line_fg, line_fg, bg, shadow );
+}
+
+void cc_buffer_blit( cc_buffer_t* self, int x, int y, const cc_buffer_t* src, const cc_rect_t* src_rect )
+{
+    if( !self || !src || !src->_back_buffer ) return;
+
+    cc_rect_t area = ( src_rect ) ? *src_rect : cc_rect_make( 0, 0, src->_width, src->_height );
+    _blit_in( self, &self->_clip, x, y, src, area );
+}
+
+void cc_buffer_draw_box( cc_buffer_t* self, int x, int y, int w, int h, const cc_color_t* fg, const cc_color_t* bg, bool red_border )
+{
+    if( !self ) return;
+
+    _draw_box_in( self, &self->_clip, x, y, w, h, fg, bg, red_border );
+}
+
+bool cc_buffer_push_clip( cc_buffer_t* self, const cc_rect_t* rect )
+{
+    if( !self || !rect ) return false;
+    if( self->_clip_depth >= CC_CLIP_STACK_MAX ) return false;
+
+    cc_rect_t clip = *rect;
+    if( self->_clip_depth > 0 ) clip = cc_rect_intersect( clip, self->_clip_stack[self->_clip_depth - 1] );
+
+    self->_clip_stack[self->_clip_depth++] = clip;
+    _update_clip( self );
+    return true;
+}
+
+void cc_buffer_pop_clip( cc_buffer_t* self )
+{
+    if( !self || self->_clip_depth == 0 ) return;
+
+    self->_clip_depth--;
+    _update_clip( self );
+}
+
+cc_rect_t cc_buffer_get_clip( const cc_buffer_t* self )
+{
+    if( !self ) return cc_rect_make( 0, 0, 0, 0 );
+    return self->_clip;
+}
+
+cc_buffer_view_t cc_buffer_view_make( cc_buffer_t* self, const cc_rect_t* rect )
+{
+    cc_buffer_view_t view = { self, 0, 0, { 0, 0, 0, 0 } };
+    if( !self ) return view;
+
+    if( rect ){
+        view._origin_x = rect->_x;
+        view._origin_y = rect->_y;
+        view._clip     = cc_rect_intersect( *rect, self->_clip );
+    } else {
+        view._clip = self->_clip;
+    }
+    return view;
+}
+
+cc_buffer_view_t cc_buffer_view_sub( const cc_buffer_view_t* parent, const cc_rect_t* rect )
+{
+    cc_buffer_view_t view = { NULL, 0, 0, { 0, 0, 0, 0 } };
+    if( !parent || !rect ) return view;
+
+    cc_rect_t area = cc_rect_make( parent->_origin_x + rect->_x, parent->_origin_y + rect->_y, rect->_w, rect->_h );
+
+    view._buffer   = parent->_buffer;
+    view._origin_x = area._x;
+    view._origin_y = area._y;
+    view._clip     = cc_rect_intersect( area, parent->_clip );
+    return view;
+}
+
+void cc_buffer_view_draw_string( const cc_buffer_view_t* view, int x, int y, const char* text, const cc_color_t* fg, const cc_color_t* bg )
+{
+    cc_rect_t clip;
+    if( !text || !_view_clip( view, &clip ) ) return;
+
+    _draw_string_in( view->_buffer, &clip, view->_origin_x + x, view->_origin_y + y, text, fg, bg );
+}
+
+void cc_buffer_view_clear_rect( const cc_buffer_view_t* view, const cc_rect_t* rect, const cc_color_t* bg_color )
+{
+    cc_rect_t clip;
+    if( !_view_clip( view, &clip ) ) return;
+
+    if( rect ){
+        cc_rect_t area = cc_rect_make( view->_origin_x + rect->_x, view->_origin_y + rect->_y, rect->_w, rect->_h );
+        clip = cc_rect_intersect( area, clip );
+    }
+    _clear_area( view->_buffer, clip, bg_color );
+}
+
+void cc_buffer_view_write_cells( const cc_buffer_view_t* view, int x, int y, const cc_cell_t* cells, int count )
+{
+    cc_rect_t clip;
+    if( !cells || count <= 0 || !_view_clip( view, &clip ) ) return;
+
+    _write_cells_in( view->_buffer, &clip, view->_origin_x + x, view->_origin_y + y, cells, count );
+}
+
+void cc_buffer_view_blit( const cc_buffer_view_t* view, int x, int y, const cc_buffer_t* src, const cc_rect_t* src_rect )
+{
+    cc_rect_t clip;
+    if( !src || !src->_back_buffer || !_view_clip( view, &clip ) ) return;
+
+    cc_rect_t area = ( src_rect ) ? *src_rect : cc_rect_make( 0, 0, src->_width, src->_height );
+    _blit_in( view->_buffer, &clip, view->_origin_x + x, view->_origin_y + y, src, area );
+}
+
+void cc_buffer_view_draw_box( const cc_buffer_view_t* view, int x, int y, int w, int h, const cc_color_t* fg, const cc_color_t* bg, bool red_border )
+{
+    cc_rect_t clip;
+    if( !_view_clip( view, &clip ) ) return;
+
+    _draw_box_in( view->_buffer, &clip, view->_origin_x + x, view->_origin_y + y, w, h, fg, bg, red_border );
+}
+
+void cc_buffer_view_fill_rect( const cc_buffer_view_t* view, const cc_rect_t* rect, const cc_cell_t* cell )
+{
+    cc_rect_t clip;
+    if( !rect || !cell || !_view_clip( view, &clip ) ) return;
+
+    cc_rect_t area = cc_rect_make( view->_origin_x + rect->_x, view->_origin_y + rect->_y, rect->_w, rect->_h );
+    _fill_area( view->_buffer, cc_rect_intersect( area, clip ), *cell );
+}
+
+void cc_buffer_view_draw_box_style( const cc_buffer_view_t* view, const cc_rect_t* rect, cc_box_style_e style, const cc_color_t* fg, const cc_color_t* bg, const cc_color_t* shadow )
+{
+    cc_rect_t clip;
+    if( !rect || !_view_clip( view, &clip ) ) return;
+
+    const cc_color_t* line_fg = ( fg ) ? fg : &CC_COLOR_WHITE;
+    cc_rect_t box = cc_rect_make( view->_origin_x + rect->_x, view->_origin_y + rect->_y, rect->_w, rect->_h );
+    _draw_frame_in( view->_buffer, &clip, box, style, line_fg, line_fg, bg, shadow );
+}
+
+void cc_buffer_scroll_region( cc_buffer_t* self, const cc_rect_t* rect, int dy )
+{
+    if( !self || !rect || !self->_back_buffer || !self->_front_buffer || dy == 0 ) return;
+
+    cc_rect_t bounds = { 0, 0, self->_width, self->_height };
+    cc_rect_t area   = cc_rect_intersect( *rect, bounds );
+    if( cc_rect_is_empty( area ) ) return;
+
+    int       width = self->_width;
+    int       top   = area._y;
+    int       bot   = area._y + area._h - 1;
+    int       move  = ( dy < 0 ) ? -dy : dy;
+    cc_cell_t blank = { ' ', _pack_color( &CC_COLOR_WHITE ), _pack_color( &CC_COLOR_BLACK ) };
+
+    // 1. 영역을 모두 벗어나는 이동은 비우기와 같음
+    if( move >= area._h ){
+        for( int y = top; y <= bot; ++y ){
+            _break_wide_pair( self, area._x, y, area._w );
+            _mark_dirty( self, y, area._x - 1, area._x + area._w );
         }
+        _fill_rect( self->_back_buffer, width, area._x, top, area._w, area._h, blank );
+        return;
+    }
 
-        cursor_x += (int)visual_width;
-        i += char_len;
+    int exposed_y = ( dy < 0 ) ? bot - move + 1 : top;
+    bool full_width = ( area._x == 0 && area._w == width );
+
+    // 2. 전체 너비 영역: Front/Back을 같이 옮기고 터미널 스크롤 명령을 대기열에 추가
+    // (1행 영역은 DECSTBM으로 지정할 수 없으므로 제외)
+    if( full_width && area._h > 1 && self->_scroll_op_count < CC_SCROLL_OPS_MAX ){
+        cc_scroll_op_t* op = &self->_scroll_ops[self->_scroll_op_count++];
+        op->_top    = top;
+        op->_bottom = bot;
+        op->_dy     = dy;
+
+        _shift_rows( self->_back_buffer, width, &area, dy );
+        _fill_rect( self->_back_buffer, width, 0, exposed_y, width, move, blank );
+        _shift_front( self, top, bot, dy );
+        return;
+    }
+
+    // 3. 일부 너비 영역: Back만 옮기고 영역 전체를 변경됨으로 기록
+    // 영역 경계에 걸친 2칸 문자는 먼저 공백으로 쪼갬
+    for( int y = top; y <= bot; ++y ){
+        cc_cell_t* row = &self->_back_buffer[INDEX( self, 0, y )];
+        _split_wide_at( row, width, area._x );
+        _split_wide_at( row, width, area._x + area._w );
+        _mark_dirty( self, y, area._x - 1, area._x + area._w );
     }
+    _shift_rows( self->_back_buffer, width, &area, dy );
+    _fill_rect( self->_back_buffer, width, area._x, exposed_y, area._w, move, blank );
 }
 
-void cc_buffer_draw_box( cc_buffer_t* self, int x, int y, int w, int h, const cc_color_t* fg, const cc_color_t* bg, bool red_border )
+void cc_buffer_set_scroll_detect( cc_buffer_t* self, bool enable )
 {
     if( !self ) return;
+    self->_scroll_detect = enable;
+}
 
-    cc_color_t border_fg = ( red_border ) ? CC_COLOR_RED : ( fg ? *fg : CC_COLOR_WHITE );
-    cc_color_t safe_bg   = ( bg ) ? *bg : CC_COLOR_BLACK;
+void cc_buffer_set_output_limit( cc_buffer_t* self, size_t max_bytes )
+{
+    if( !self ) return;
 
-    // Corners
-    cc_buffer_draw_string( self, x, y, "┏", &border_fg, &safe_bg );
-    cc_buffer_draw_string( self, x + w - 1, y, "┓", &border_fg, &safe_bg );
-    cc_buffer_draw_string( self, x, y + h - 1, "┗", &border_fg, &safe_bg );
-    cc_buffer_draw_string( self, x + w - 1, y + h - 1, "┛", &border_fg, &safe_bg );
+    if( max_bytes > 0 && max_bytes < CC_FLUSH_MIN_LIMIT ){
+        max_bytes = CC_FLUSH_MIN_LIMIT;
+    }
+    self->_out_limit = max_bytes;
+
+    // 이미 한도보다 큰 버퍼는 줄여둠 (실패해도 기존 버퍼 유지)
+    if( max_bytes > 0 && self->_out_cap > max_bytes ){
+        char* new_buf = (char*)realloc( self->_out_buf, max_bytes );
+        if( new_buf ){
+            self->_out_buf = new_buf;
+            self->_out_cap = max_bytes;
+        }
+    }
+}
 
-    // Horizontal Lines
-    for( int i = x + 1; i < x + w - 1; ++i ){
-        cc_buffer_draw_string( self, i, y, "━", &border_fg, &safe_bg );
-        cc_buffer_draw_string( self, i, y + h - 1, "━", &border_fg, &safe_bg );
+void cc_buffer_set_color_mode( cc_buffer_t* self, cc_color_mode_e mode )
+{
+    if( !self || self->_color_mode == mode ) return;
+
+    self->_color_mode = mode;
+
+    // 이미 출력된 화면은 이전 모드의 색이므로 다음 flush에서 전체를 다시 그림
+    if( self->_front_buffer ){
+        _invalidate_front( self );
     }
+}
 
-    // Vertical Lines
-    for( int j = y + 1; j < y + h - 1; ++j ){
-        cc_buffer_draw_string( self, x, j, "┃", &border_fg, &safe_bg );
-        cc_buffer_draw_string( self, x + w - 1, j, "┃", &border_fg, &safe_bg );
+void cc_buffer_set_term_caps( cc_buffer_t* self, uint32_t caps )
+{
+    if( !self ) return;
+    self->_term_caps = caps;
+}
+
+bool cc_buffer_set_flush_threads( cc_buffer_t* self, int threads )
+{
+    if( !self ) return false;
+
+    _pool_destroy( self->_flush_pool );
+    self->_flush_pool = NULL;
+
+    if( threads <= 1 ) return true;
+
+    self->_flush_pool = _pool_create( self, threads );
+    return self->_flush_pool != NULL;
+}
+
+bool cc_buffer_set_async_output( cc_buffer_t* self, bool enable )
+{
+    if( !self ) return false;
+    if( enable == ( self->_writer != NULL ) ) return true;
+
+    if( !enable ){
+        _writer_destroy( self->_writer );
+        self->_writer = NULL;
+        return true;
     }
 
-    // Fill Center
-    for( int j = y + 1; j < y + h - 1; ++j ){
-        for( int i = x + 1; i < x + w - 1; ++i ){
-            // 배경색 적용을 위해 공백 출력
-            cc_buffer_draw_string( self, i, j, " ", fg, bg );
+    // 앞서 printf 등으로 쌓인 출력이 프레임보다 먼저 나가도록
+    fflush( stdout );
+    self->_writer = _writer_create( self->_sink );
+    return self->_writer != NULL;
+}
+
+bool cc_buffer_set_sink( cc_buffer_t* self, cc_sink_t* sink )
+{
+    if( !self ) return false;
+    if( sink == cc_sink_stdout() ) sink = NULL;
+    if( sink == self->_sink ) return true;
+
+    // 비동기 출력: 보내지 않은 대기 프레임은 버리고 다음 프레임부터 새 Sink로 보냄
+    // (전송 중인 프레임은 기다리지 않고 출력 스레드가 이전 Sink로 마저 보냄)
+    if( self->_writer ){
+        if( self->_back_buffer ) _writer_reclaim( self );
+        if( !_writer_set_sink( self->_writer, sink ) ) return false;
+    }
+
+    self->_sink = sink;
+    if( self->_back_buffer ) _invalidate_front( self );
+    return true;
+}
+
+void cc_buffer_wait_output( cc_buffer_t* self )
+{
+    if( !self || !self->_writer ) return;
+    _writer_drain( self->_writer );
+}
+
+void cc_buffer_take_dirty( cc_buffer_t* self, cc_dirty_span_fn fn, void* user )
+{
+    if( !self || !self->_dirty_rows ) return;
+
+    size_t words = ( (size_t)self->_height + 63 ) / 64;
+    for( size_t word = 0; word < words; ++word ){
+        uint64_t bits = self->_dirty_rows[word];
+        self->_dirty_rows[word] = 0;
+
+        while( bits ){
+            int y = (int)( word * 64 ) + __builtin_ctzll( bits );
+            bits &= bits - 1;
+
+            cc_dirty_span_t span = self->_dirty_spans[y];
+            self->_dirty_spans[y]._min_x = INT_MAX;
+            self->_dirty_spans[y]._max_x = -1;
+
+            if( fn && span._min_x <= span._max_x ) fn( user, y, span._min_x, span._max_x );
         }
     }
 }
 
-void cc_buffer_flush( cc_buffer_t* self )
+bool cc_buffer_take_scroll( cc_buffer_t* self )
 {
-    if( !self || !self->_front_buffer || !self->_back_buffer ) return;
+    if( !self ) return false;
 
-    // 1. 출력 버퍼 할당 (Performance Optimization)
-    // 화면 크기 * (Color seq + Move seq + Char bytes) + Margin
-    // 매번 시스템 콜(printf)을 호출하는 오버헤드를 줄이기 위해 하나의 큰 문자열로 만듭니다.
-    size_t capacity = (size_t)( self->_width * self->_height * 64 ) + 4096;
-    char* out_buf = (char*)malloc( capacity );
-    if( !out_buf ) return; // Fatal: Memory alloc failed
+    bool scrolled = self->_scroll_op_count > 0;
+    self->_scroll_op_count = 0;
+    return scrolled;
+}
 
-    char* ptr = out_buf;
-    char* end = out_buf + capacity;
+void cc_buffer_write_cells_unclipped( cc_buffer_t* self, int x, int y, const cc_cell_t* cells, int count )
+{
+    if( !self || !cells || count <= 0 || !self->_back_buffer ) return;
 
-    // 최적화를 위한 상태 추적 변수
-    cc_color_t last_fg = CC_COLOR_WHITE;
-    cc_color_t last_bg = CC_COLOR_BLACK;
-    bool color_set = false;
+    cc_rect_t bounds = { 0, 0, self->_width, self->_height };
+    _write_cells_in( self, &bounds, x, y, cells, count );
+}
 
-    // 터미널의 실제 커서 위치 추적 (1-based)
-    // 초기값은 불가능한 좌표로 설정하여 첫 그리기 시 무조건 커서 이동 명령이 발생하게 함
-    int term_cursor_y = -1;
-    int term_cursor_x = -1;
+void cc_buffer_fill_rect_unclipped( cc_buffer_t* self, const cc_rect_t* rect, const cc_cell_t* cell )
+{
+    if( !self || !rect || !cell || !self->_back_buffer ) return;
 
-    for( int y = 0; y < self->_height; ++y ){
-        for( int x = 0; x < self->_width; ++x ){
-            int idx = ( y * self->_width ) + x;
-            cc_cell_t* back  = &self->_back_buffer[idx];
-            cc_cell_t* front = &self->_front_buffer[idx];
-
-            // A. 변경 감지 (Diff)
-            // 이전 프레임(front)과 현재 프레임(back)이 같다면 그리기 건너뜀
-            if( _is_cell_equal( back, front ) ){
-                continue;
-            }
+    cc_rect_t bounds = { 0, 0, self->_width, self->_height };
+    _fill_area( self, cc_rect_intersect( *rect, bounds ), *cell );
+}
 
-            // B. Wide char Trail 스킵
-            // (한글 등 2칸 문자 뒤에 오는 더미 데이터는 그리지 않고 상태만 동기화)
-            if( back->_is_wide_trail ){
-                *front = *back;
-                continue;
-            }
+void cc_buffer_damage( cc_buffer_t* self, const cc_rect_t* rect )
+{
+    if( !self || !rect || !self->_back_buffer ) return;
 
-            // C. 커서 이동 최적화
-            // 우리가 그리려는 좌표(0-based)를 터미널 좌표(1-based)로 변환
-            int target_y = y + 1;
-            int target_x = x + 1;
+    cc_rect_t bounds = { 0, 0, self->_width, self->_height };
+    cc_rect_t area   = cc_rect_intersect( *rect, bounds );
+    if( cc_rect_is_empty( area ) ) return;
 
-            // 터미널 커서가 이미 그릴 위치에 있다면 이동 명령 생략 (Sequential writing optimization)
-            if( term_cursor_y != target_y || term_cursor_x != target_x ){
-                // ANSI Move: \033[row;colH
-                int written = snprintf( ptr, end - ptr, "\033[%d;%dH", target_y, target_x );
-                if( written > 0 ) ptr += written;
+    for( int y = area._y; y < area._y + area._h; ++y ){
+        _mark_dirty( self, y, area._x, area._x + area._w - 1 );
+    }
+}
 
-                term_cursor_y = target_y;
-                term_cursor_x = target_x;
+int cc_buffer_get_damage( const cc_buffer_t* self, cc_rect_t* out_rects, int max_rects )
+{
+    if( !self || !out_rects || max_rects <= 0 || !self->_dirty_rows ) return 0;
+
+    if( max_rects > CC_DAMAGE_RECTS_MAX ) max_rects = CC_DAMAGE_RECTS_MAX;
+
+    // 작업 공간: 결과 max_rects 개 + 이번 행에서 새로 생긴 사각형 1개
+    cc_rect_t rects[CC_DAMAGE_RECTS_MAX + 1];
+
+    int count = 0;
+    size_t words = ( (size_t)self->_height + 63 ) / 64;
+    for( size_t word = 0; word < words; ++word ){
+        uint64_t bits = self->_dirty_rows[word];
+        while( bits ){
+            int y = (int)( word * 64 ) + __builtin_ctzll( bits );
+            bits &= bits - 1;
+
+            const cc_dirty_span_t* span = &self->_dirty_spans[y];
+            if( span->_min_x > span->_max_x ) continue;
+            cc_rect_t row = cc_rect_make( span->_min_x, y, span->_max_x - span->_min_x + 1, 1 );
+
+            // 바로 윗행에서 끝나고 열이 겹치는 사각형이 있으면 아래로 늘림
+            int k = 0;
+            for( ; k < count; ++k ){
+                const cc_rect_t* r = &rects[k];
+                if( r->_y + r->_h == y && row._x < r->_x + r->_w && r->_x < row._x + row._w ) break;
             }
-
-            // D. 색상 변경 최적화 (Stateful)
-            // 이전 문자와 색상이 다를 때만 ANSI 색상 코드 전송
-            if( !color_set || !cc_color_is_equal( &back->_fg, &last_fg ) ){
-                char ansi[64];
-                cc_color_to_ansi_fg( &back->_fg, ansi, sizeof(ansi) );
-                int written = snprintf( ptr, end - ptr, "%s", ansi );
-                if( written > 0 ) ptr += written;
-                last_fg = back->_fg;
+            if( k < count ){
+                rects[k] = _rect_union( rects[k], row );
             }
-
-            if( !color_set || !cc_color_is_equal( &back->_bg, &last_bg ) ){
-                char ansi[64];
-                cc_color_to_ansi_bg( &back->_bg, ansi, sizeof(ansi) );
-                int written = snprintf( ptr, end - ptr, "%s", ansi );
-                if( written > 0 ) ptr += written;
-                last_bg = back->_bg;
+            else{
+                rects[count++] = row;
+                if( count > max_rects ) _reduce_last_rect( rects, &count );
             }
-            color_set = true;
+        }
+    }
 
-            // E. 문자 출력
-            size_t ch_len = strlen( back->_ch );
-            if( ptr + ch_len < end ){
-                memcpy( ptr, back->_ch, ch_len );
-                ptr += ch_len;
-            }
+    _merge_overlaps( rects, &count );
+    memcpy( out_rects, rects, sizeof( cc_rect_t ) * count );
+    return count;
+}
+
+void cc_buffer_flush( cc_buffer_t* self )
+{
+    if( !self || !self->_front_buffer || !self->_back_buffer ) return;
+
+    // 1. 출력 버퍼 준비 (Performance Optimization)
+    // 매번 시스템 콜(printf)을 호출하는 오버헤드를 줄이기 위해 하나의 큰 문자열로 만듭니다.
+    // 버퍼는 객체가 소유하며 프레임마다 비우고 재사용합니다. (필요할 때만 확장)
+    // 터미널의 실제 커서 위치/색상은 "모름"에서 시작하여 추적
+    flush_ctx_t  ctx;
+    out_frame_t* frame = NULL;
+    if( self->_writer ){
+        // 비동기 출력: 아직 보내지 못한 이전 프레임은 버리고 그 범위까지 이번 프레임에 포함
+        // 프레임 전체를 한 번에 넘기므로 최대 크기(부분 출력)는 적용하지 않음
+        _writer_reclaim( self );
+        frame = &self->_writer->_build;
+        _init_ctx( &ctx, self, &frame->_data, &frame->_cap, 0 );
+    }
+    else{
+        _init_ctx( &ctx, self, &self->_out_buf, &self->_out_cap, self->_out_limit );
+    }
+
+    // 동기화 출력 시작 (DEC 2026: 끝 표시가 올 때까지 터미널이 화면 갱신을 보류)
+    bool sync = ( ctx._caps & CC_TERM_CAP_SYNC ) && _out_reserve( &ctx, CC_SYNC_SEQ_LEN );
+    if( sync ){
+        memcpy( ctx._ptr, "\033[?2026h", CC_SYNC_SEQ_LEN );
+        ctx._ptr += CC_SYNC_SEQ_LEN;
+    }
 
-            // F. Front 버퍼 동기화 (Commit)
-            *front = *back;
+    // 스크롤 먼저 처리 (Front가 터미널과 같은 모양으로 이동된 뒤 나머지를 비교)
+    if( _flush_scroll( self, &ctx ) && frame ){
+        frame->_full = true;
+    }
 
-            // G. 커서 위치 추적 업데이트
-            // 문자 너비만큼 x 좌표 증가 (한글이면 +2, 영문이면 +1)
-            size_t width_step = cc_util_get_string_width( back->_ch );
-            term_cursor_x += (int)width_step;
+    // 변경된 행이 충분히 많으면 행 묶음 단위로 병렬 인코딩
+    size_t words = ( (size_t)self->_height + 63 ) / 64;
+    bool   done  = false;
+    if( self->_flush_pool ){
+        int dirty_count = 0;
+        for( size_t word = 0; word < words; ++word ){
+            dirty_count += __builtin_popcountll( self->_dirty_rows[word] );
+        }
+        if( dirty_count >= self->_flush_pool->_band_count * CC_PARALLEL_MIN_ROWS ){
+            done = _flush_parallel( self, &ctx );
+        }
+        for( int i = 0; done && frame && i < dirty_count; ++i ){
+            const flush_job_t* job = &self->_flush_pool->_jobs[i];
+            _frame_note_row( frame, job->_y, job->_min_x, job->_max_x );
         }
     }
 
-    // 2. 최종 출력 (System Call)
-    // 모아둔 버퍼를 한 번에 터미널로 전송
-    if( ptr > out_buf ){
-        // 색상 리셋을 마지막에 해주는 것이 안전함 (선택 사항)
-        // const char* reset = "\033[0m";
-        // if( ptr + 4 < end ) { memcpy(ptr, reset, 4); ptr += 4; }
+    // 변경 기록이 있는 행만 순회 (비트맵 64행 단위)
+    for( size_t word = 0; !done && word < words; ++word ){
+        uint64_t bits = self->_dirty_rows[word];
+        self->_dirty_rows[word] = 0;
+
+        while( bits ){
+            int y = (int)( word * 64 ) + __builtin_ctzll( bits );
+            bits &= bits - 1;
+
+            cc_dirty_span_t span = self->_dirty_spans[y];
+            self->_dirty_spans[y]._min_x = INT_MAX;
+            self->_dirty_spans[y]._max_x = -1;
+
+            if( frame ) _frame_note_row( frame, y, span._min_x, span._max_x );
+            int fail_x = _flush_row( self, &ctx, y, span._min_x, span._max_x );
+            if( fail_x >= 0 ) _mark_dirty( self, y, fail_x, span._max_x );
+        }
+    }
 
-        fwrite( out_buf, 1, ptr - out_buf, stdout );
-        fflush( stdout );
+    // 동기화 출력 끝 (변경이 없었으면 시작 표시까지 버림)
+    if( sync ){
+        if( ctx._ptr == *ctx._buf + CC_SYNC_SEQ_LEN && ctx._streamed == 0 ){
+            ctx._ptr = *ctx._buf;
+        }
+        else if( _out_reserve( &ctx, CC_SYNC_SEQ_LEN ) ){
+            memcpy( ctx._ptr, "\033[?2026l", CC_SYNC_SEQ_LEN );
+            ctx._ptr += CC_SYNC_SEQ_LEN;
+        }
     }
 
-    free( out_buf );
-}
\ No newline at end of file
+    // 2. 최종 출력 (System Call)
+    // 모아둔 버퍼를 한 번에 터미널로 전송 (비동기 출력이면 출력 스레드에 넘기고 바로 반환)
+    size_t len = (size_t)( ctx._ptr - *ctx._buf );
+    if( frame ){
+        if( len > 0 ) _writer_submit( self->_writer, len );
+        else          _frame_reset( frame );
+    }
+    else if( len > 0 || ctx._streamed > 0 ){
+        // 파일 Sink 등 자체 버퍼가 있는 Sink도 프레임이 바로 나가도록 내보냄
+        if( len == 0 || cc_sink_write( ctx._sink, *ctx._buf, len ) ) cc_sink_flush( ctx._sink );
+    }
+}
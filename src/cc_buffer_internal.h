@@ -0,0 +1,57 @@
+#ifndef _CONSOLE_C_BUFFER_INTERNAL_H_
+#define _CONSOLE_C_BUFFER_INTERNAL_H_
+
+/** ------------------------------------------------------------------------------------
+ * ConsoleC Buffer Internal Header
+ * ------------------------------------------------------------------------------------
+ * 라이브러리 내부 모듈(cc_layer 등)이 cc_buffer 를 다룰 때 쓰는 셀 매크로와 접근 함수입니다.
+ * 공개 헤더가 아니며 include/ 에 두지 않습니다.
+ * ------------------------------------------------------------------------------------ */
+
+#include "console_c/cc_buffer.h"
+
+// -----------------------------------------------------------------------------
+// Cell Macros
+// -----------------------------------------------------------------------------
+
+#define CELL_FLAGS( _cell ) ( ( _cell )->_glyph >> CC_CELL_FLAG_SHIFT )
+#define CELL_GLYPH( _cell ) ( ( _cell )->_glyph & CC_CELL_GLYPH_MASK )
+#define COLOR_TYPE( _color ) ( ( _color ) >> CC_CELL_TYPE_SHIFT )
+
+// -----------------------------------------------------------------------------
+// Internal Accessors
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief 변경 행 하나를 받는 함수 (user = cc_buffer_take_dirty 에 넘긴 값)
+ */
+typedef void (*cc_dirty_span_fn)( void* user, int y, int min_x, int max_x );
+
+/**
+ * @brief 변경 기록을 꺼내고 비웁니다. (flush 하지 않는 버퍼용)
+ * @details 변경 행 비트맵을 64행 단위로 훑어 변경된 행만 fn 에 넘깁니다.
+ * @param self 대상 버퍼
+ * @param fn 변경 행마다 호출할 함수 (NULL = 비우기만)
+ * @param user fn 에 그대로 전달할 값
+ */
+void cc_buffer_take_dirty( cc_buffer_t* self, cc_dirty_span_fn fn, void* user );
+
+/**
+ * @brief 대기 중인 스크롤 명령을 버립니다. (flush 하지 않는 버퍼용)
+ * @details 버퍼 전체 너비 스크롤은 옮긴 행을 변경으로 기록하지 않으므로, 꺼낸 쪽이 영역 전체를 다시 그려야 합니다.
+ * @return 버린 스크롤 명령이 있었는지 여부
+ */
+bool cc_buffer_take_scroll( cc_buffer_t* self );
+
+/**
+ * @brief Clip을 무시하고 셀을 씁니다. (cc_buffer_write_cells 와 같되 버퍼 범위로만 자름)
+ * @details 합성 결과처럼 앱이 쌓아둔 Clip과 관계없이 반드시 기록되어야 하는 셀에 사용합니다.
+ */
+void cc_buffer_write_cells_unclipped( cc_buffer_t* self, int x, int y, const cc_cell_t* cells, int count );
+
+/**
+ * @brief Clip을 무시하고 영역을 셀로 채웁니다. (cc_buffer_fill_rect 와 같되 버퍼 범위로만 자름)
+ */
+void cc_buffer_fill_rect_unclipped( cc_buffer_t* self, const cc_rect_t* rect, const cc_cell_t* cell );
+
+#endif // _CONSOLE_C_BUFFER_INTERNAL_H_
\ No newline at end of file
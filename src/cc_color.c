@@ -10,6 +10,7 @@
 #include <string.h> // strlen, strncmp (문자열 길이 및 비교)
 #include <stdlib.h> // strtoul (Hex 문자열 파싱)
 #include <ctype.h>  // isxdigit (Hex 문자 판별)
+#include <stdatomic.h> // 양자화 캐시 (스레드 안전)
 
 // -----------------------------------------------------------------------------
 // Global Presets Definition
@@ -24,6 +25,117 @@ const cc_color_t CC_COLOR_CYAN    = { CC_COLOR_TYPE_RGB,   { 0,   255, 255 } };
 const cc_color_t CC_COLOR_MAGENTA = { CC_COLOR_TYPE_RGB,   { 255, 0,   255 } };
 const cc_color_t CC_COLOR_GRAY    = { CC_COLOR_TYPE_RGB,   { 128, 128, 128 } };
 const cc_color_t CC_COLOR_RESET   = { CC_COLOR_TYPE_RESET, { 0,   0,   0   } };
+const cc_color_t CC_COLOR_NONE    = { CC_COLOR_TYPE_NONE,  { 0,   0,   0   } };
+
+// -----------------------------------------------------------------------------
+// Palette Quantization
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief xterm 기본 256색 팔레트 (0xRRGGBB)
+ * @details 0~15: 기본 16색, 16~231: 6x6x6 큐브, 232~255: 회색조
+ */
+static const uint32_t _XTERM_PALETTE[256] =
+{
+    0x000000, 0x800000, 0x008000, 0x808000, 0x000080, 0x800080, 0x008080, 0xC0C0C0,
+    0x808080, 0xFF0000, 0x00FF00, 0xFFFF00, 0x0000FF, 0xFF00FF, 0x00FFFF, 0xFFFFFF,
+    0x000000, 0x00005F, 0x000087, 0x0000AF, 0x0000D7, 0x0000FF, 0x005F00, 0x005F5F,
+    0x005F87, 0x005FAF, 0x005FD7, 0x005FFF, 0x008700, 0x00875F, 0x008787, 0x0087AF,
+    0x0087D7, 0x0087FF, 0x00AF00, 0x00AF5F, 0x00AF87, 0x00AFAF, 0x00AFD7, 0x00AFFF,
+    0x00D700, 0x00D75F, 0x00D787, 0x00D7AF, 0x00D7D7, 0x00D7FF, 0x00FF00, 0x00FF5F,
+    0x00FF87, 0x00FFAF, 0x00FFD7, 0x00FFFF, 0x5F0000, 0x5F005F, 0x5F0087, 0x5F00AF,
+    0x5F00D7, 0x5F00FF, 0x5F5F00, 0x5F5F5F, 0x5F5F87, 0x5F5FAF, 0x5F5FD7, 0x5F5FFF,
+    0x5F8700, 0x5F875F, 0x5F8787, 0x5F87AF, 0x5F87D7, 0x5F87FF, 0x5FAF00, 0x5FAF5F,
+    0x5FAF87, 0x5FAFAF, 0x5FAFD7, 0x5FAFFF, 0x5FD700, 0x5FD75F, 0x5FD787, 0x5FD7AF,
+    0x5FD7D7, 0x5FD7FF, 0x5FFF00, 0x5FFF5F, 0x5FFF87, 0x5FFFAF, 0x5FFFD7, 0x5FFFFF,
+    0x870000, 0x87005F, 0x870087, 0x8700AF, 0x8700D7, 0x8700FF, 0x875F00, 0x875F5F,
+    0x875F87, 0x875FAF, 0x875FD7, 0x875FFF, 0x878700, 0x87875F, 0x878787, 0x8787AF,
+    0x8787D7, 0x8787FF, 0x87AF00, 0x87AF5F, 0x87AF87, 0x87AFAF, 0x87AFD7, 0x87AFFF,
+    0x87D700, 0x87D75F, 0x87D787, 0x87D7AF, 0x87D7D7, 0x87D7FF, 0x87FF00, 0x87FF5F,
+    0x87FF87, 0x87FFAF, 0x87FFD7, 0x87FFFF, 0xAF0000, 0xAF005F, 0xAF0087, 0xAF00AF,
+    0xAF00D7, 0xAF00FF, 0xAF5F00, 0xAF5F5F, 0xAF5F87, 0xAF5FAF, 0xAF5FD7, 0xAF5FFF,
+    0xAF8700, 0xAF875F, 0xAF8787, 0xAF87AF, 0xAF87D7, 0xAF87FF, 0xAFAF00, 0xAFAF5F,
+    0xAFAF87, 0xAFAFAF, 0xAFAFD7, 0xAFAFFF, 0xAFD700, 0xAFD75F, 0xAFD787, 0xAFD7AF,
+    0xAFD7D7, 0xAFD7FF, 0xAFFF00, 0xAFFF5F, 0xAFFF87, 0xAFFFAF, 0xAFFFD7, 0xAFFFFF,
+    0xD70000, 0xD7005F, 0xD70087, 0xD700AF, 0xD700D7, 0xD700FF, 0xD75F00, 0xD75F5F,
+    0xD75F87, 0xD75FAF, 0xD75FD7, 0xD75FFF, 0xD78700, 0xD7875F, 0xD78787, 0xD787AF,
+    0xD787D7, 0xD787FF, 0xD7AF00, 0xD7AF5F, 0xD7AF87, 0xD7AFAF, 0xD7AFD7, 0xD7AFFF,
+    0xD7D700, 0xD7D75F, 0xD7D787, 0xD7D7AF, 0xD7D7D7, 0xD7D7FF, 0xD7FF00, 0xD7FF5F,
+    0xD7FF87, 0xD7FFAF, 0xD7FFD7, 0xD7FFFF, 0xFF0000, 0xFF005F, 0xFF0087, 0xFF00AF,
+    0xFF00D7, 0xFF00FF, 0xFF5F00, 0xFF5F5F, 0xFF5F87, 0xFF5FAF, 0xFF5FD7, 0xFF5FFF,
+    0xFF8700, 0xFF875F, 0xFF8787, 0xFF87AF, 0xFF87D7, 0xFF87FF, 0xFFAF00, 0xFFAF5F,
+    0xFFAF87, 0xFFAFAF, 0xFFAFD7, 0xFFAFFF, 0xFFD700, 0xFFD75F, 0xFFD787, 0xFFD7AF,
+    0xFFD7D7, 0xFFD7FF, 0xFFFF00, 0xFFFF5F, 0xFFFF87, 0xFFFFAF, 0xFFFFD7, 0xFFFFFF,
+    0x080808, 0x121212, 0x1C1C1C, 0x262626, 0x303030, 0x3A3A3A, 0x444444, 0x4E4E4E,
+    0x585858, 0x626262, 0x6C6C6C, 0x767676, 0x808080, 0x8A8A8A, 0x949494, 0x9E9E9E,
+    0xA8A8A8, 0xB2B2B2, 0xBCBCBC, 0xC6C6C6, 0xD0D0D0, 0xDADADA, 0xE4E4E4, 0xEEEEEE,
+};
+
+#define CC_QUANT_CACHE_BITS 12                          /**< 모드별 캐시 크기 (2^12 = 4096개) */
+#define CC_QUANT_CACHE_SIZE ( 1u << CC_QUANT_CACHE_BITS )
+
+/**
+ * @brief 모드별 양자화 결과 캐시 (Direct-Mapped)
+ * @details 항목 = ~( RGB << 8 | 인덱스 ). 비트 반전으로 저장하여 0으로 초기화된 항목이
+ * 유효한 결과(검정 -> 0)와 구분되도록 했습니다. 한 워드 단위로 읽고 쓰므로 잠금이 필요 없습니다.
+ */
+static _Atomic uint32_t g_quant_cache[2][CC_QUANT_CACHE_SIZE];
+
+/**
+ * @brief 두 RGB 값의 지각 거리 (Redmean 근사, 제곱 거리)
+ */
+static uint32_t _color_distance( uint32_t lhs, uint32_t rhs )
+{
+    int r1 = ( lhs >> 16 ) & 0xFF, g1 = ( lhs >> 8 ) & 0xFF, b1 = lhs & 0xFF;
+    int r2 = ( rhs >> 16 ) & 0xFF, g2 = ( rhs >> 8 ) & 0xFF, b2 = rhs & 0xFF;
+    int rmean = ( r1 + r2 ) / 2;
+    int dr = r1 - r2, dg = g1 - g2, db = b1 - b2;
+
+    return (uint32_t)( ( ( 512 + rmean ) * dr * dr ) >> 8 )
+         + (uint32_t)( 4 * dg * dg )
+         + (uint32_t)( ( ( 767 - rmean ) * db * db ) >> 8 );
+}
+
+/**
+ * @brief 팔레트 [first, last] 범위에서 가장 가까운 색 인덱스 탐색
+ */
+static uint8_t _find_nearest( uint32_t rgb, int first, int last )
+{
+    int      best      = first;
+    uint32_t best_dist = UINT32_MAX;
+
+    for( int i = first; i <= last; ++i ){
+        uint32_t dist = _color_distance( rgb, _XTERM_PALETTE[i] );
+        if( dist < best_dist ){
+            best      = i;
+            best_dist = dist;
+            if( dist == 0 ) break;
+        }
+    }
+    return (uint8_t)best;
+}
+
+uint8_t cc_color_quantize( const cc_rgb_t* rgb, cc_color_mode_e mode )
+{
+    if( !rgb || mode == CC_COLOR_MODE_TRUECOLOR ){
+        return 0;
+    }
+
+    uint32_t key = ( (uint32_t)rgb->_r << 16 ) | ( (uint32_t)rgb->_g << 8 ) | rgb->_b;
+
+    // 1. 캐시 조회 (RGB가 일치할 때만 적중)
+    _Atomic uint32_t* slot  = &g_quant_cache[mode == CC_COLOR_MODE_16][( key * 2654435761u ) >> ( 32 - CC_QUANT_CACHE_BITS )];
+    uint32_t          entry = ~atomic_load_explicit( slot, memory_order_relaxed );
+    if( ( entry >> 8 ) == key && entry != UINT32_MAX ){
+        return (uint8_t)( entry & 0xFF );
+    }
+
+    // 2. 팔레트 탐색 후 캐시에 기록
+    uint8_t index = ( mode == CC_COLOR_MODE_16 ) ? _find_nearest( key, 0, 15 )
+                                                 : _find_nearest( key, 16, 255 );
+    atomic_store_explicit( slot, ~( ( key << 8 ) | index ), memory_order_relaxed );
+    return index;
+}
 
 // -----------------------------------------------------------------------------
 // Implementation
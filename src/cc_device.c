@@ -57,6 +57,14 @@ static pthread_cond_t    g_cursor_req_cond = PTHREAD_COND_INITIALIZER;
 static bool              g_cursor_req_pending = false;
 static cc_coord_t        g_cursor_req_result  = {0, 0};
 
+// Mode Request Sync (DECRQM)
+static pthread_mutex_t   g_mode_req_mtx     = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t    g_mode_req_cond    = PTHREAD_COND_INITIALIZER;
+static bool              g_mode_req_pending = false;
+static int               g_mode_req_mode    = 0;
+static cc_mode_state_e   g_mode_req_result  = CC_MODE_STATE_UNKNOWN;
+static int               g_last_mode_report[2] = {0, 0}; // { mode, state }
+
 // Internal Constants
 static const uint64_t EVENT_CODE_INTERRUPT = 1;
 static const uint64_t EVENT_CODE_RESIZE    = 2;
@@ -165,6 +173,7 @@ cc_key_code_e cc_device_get_input( int timeout_ms )
 
     cc_key_code_e result_key = CC_KEY_NONE;
     struct timespec start_ts, curr_ts;
+    bool polled = false; // select를 한 번 이상 호출했는지 (timeout 0도 한 번은 확인)
 
     if( timeout_ms > 0 ) {
         clock_gettime( CLOCK_MONOTONIC, &start_ts );
@@ -197,6 +206,18 @@ cc_key_code_e cc_device_get_input( int timeout_ms )
                     continue;
                 }
 
+                // [Intercept Mode Report]
+                if( key == CC_KEY_MODE_EVENT ) {
+                    pthread_mutex_lock( &g_mode_req_mtx );
+                    if( g_mode_req_pending && g_mode_req_mode == g_last_mode_report[0] ) {
+                        g_mode_req_result  = (cc_mode_state_e)g_last_mode_report[1];
+                        g_mode_req_pending = false;
+                        pthread_cond_signal( &g_mode_req_cond );
+                    }
+                    pthread_mutex_unlock( &g_mode_req_mtx );
+                    continue;
+                }
+
                 if( key != CC_KEY_NONE ) {
                     result_key = key;
                     break; // Found Key!
@@ -218,7 +239,8 @@ cc_key_code_e cc_device_get_input( int timeout_ms )
                 remaining = timeout_ms - elapsed_ms;
             }
 
-            if( remaining <= 0 ) {
+            if( remaining < 0 ) remaining = 0;
+            if( remaining == 0 && polled ) {
                 result_key = CC_KEY_NONE; // Timeout
                 break;
             }
@@ -237,6 +259,7 @@ cc_key_code_e cc_device_get_input( int timeout_ms )
         int max_fd = ( g_event_fd > STDIN_FILENO ) ? g_event_fd : STDIN_FILENO;
 
         int ret = select( max_fd + 1, &readfds, NULL, NULL, ptv );
+        polled = true;
 
         if( ret < 0 ) {
             if( errno == EINTR ) continue; // Signal caught, retry
@@ -388,6 +411,67 @@ bool cc_device_get_cursor_pos( int timeout_ms, cc_coord_t* out_coord )
     }
 }
 
+bool cc_device_query_mode( int mode, int timeout_ms, cc_mode_state_e* out_state )
+{
+    // 1. Mark Pending (응답이 요청보다 먼저 처리되는 경쟁을 막기 위해 전송 전에 설정)
+    pthread_mutex_lock( &g_mode_req_mtx );
+    g_mode_req_pending = true;
+    g_mode_req_mode    = mode;
+    pthread_mutex_unlock( &g_mode_req_mtx );
+
+    // 2. Send Request (\033[?<mode>$p -> 응답 \033[?<mode>;<state>$y)
+    char req[32];
+    int  len = snprintf( req, sizeof(req), "\033[?%d$p", mode );
+    bool success = ( write( STDOUT_FILENO, req, len ) == len );
+
+    if( success && atomic_load( &g_is_input_running ) ) {
+        // [Observer Mode] 입력 루프가 응답을 가로채 신호를 줄 때까지 대기
+        struct timespec ts;
+        clock_gettime( CLOCK_REALTIME, &ts );
+        ts.tv_sec  += timeout_ms / 1000;
+        ts.tv_nsec += ( timeout_ms % 1000 ) * 1000000;
+        if( ts.tv_nsec >= 1000000000 ) {
+            ts.tv_sec += 1;
+            ts.tv_nsec -= 1000000000;
+        }
+
+        pthread_mutex_lock( &g_mode_req_mtx );
+        while( g_mode_req_pending ) {
+            if( pthread_cond_timedwait( &g_mode_req_cond, &g_mode_req_mtx, &ts ) != 0 ) break;
+        }
+        pthread_mutex_unlock( &g_mode_req_mtx );
+    }
+    else if( success ) {
+        // [Direct Mode] 직접 입력 루프를 돌림 (get_input이 응답을 가로채 Pending을 해제)
+        struct timespec start_ts, curr_ts;
+        clock_gettime( CLOCK_MONOTONIC, &start_ts );
+
+        while( true ) {
+            pthread_mutex_lock( &g_mode_req_mtx );
+            bool pending = g_mode_req_pending;
+            pthread_mutex_unlock( &g_mode_req_mtx );
+            if( !pending ) break;
+
+            clock_gettime( CLOCK_MONOTONIC, &curr_ts );
+            long elapsed = (curr_ts.tv_sec - start_ts.tv_sec) * 1000 +
+                           (curr_ts.tv_nsec - start_ts.tv_nsec) / 1000000;
+            int remaining = timeout_ms - (int)elapsed;
+            if( remaining <= 0 ) break;
+
+            cc_device_get_input( remaining );
+        }
+    }
+
+    // 3. Collect Result
+    pthread_mutex_lock( &g_mode_req_mtx );
+    success = success && !g_mode_req_pending;
+    if( success && out_state ) *out_state = g_mode_req_result;
+    g_mode_req_pending = false;
+    pthread_mutex_unlock( &g_mode_req_mtx );
+
+    return success;
+}
+
 void cc_device_inspect( cc_key_code_e key_code, cc_input_event_t* out_event )
 {
     if( !out_event ) return;
@@ -544,6 +628,17 @@ static cc_key_code_e _parse_input_buffer( size_t* out_consumed )
             *out_consumed = t_pos + 1;
             char term = g_input_buf[t_pos];
 
+            // Mode Report (\033[?mode;state$y)
+            if( term == 'y' && g_input_buf[2] == '?' ) {
+                int mode=0, state=0;
+                if( sscanf( g_input_buf, "\033[?%d;%d$y", &mode, &state ) == 2 ) {
+                    g_last_mode_report[0] = mode;
+                    g_last_mode_report[1] = state;
+                    return CC_KEY_MODE_EVENT;
+                }
+                return CC_KEY_NONE;
+            }
+
             // Cursor Pos (\033[row;colR)
             if( term == 'R' ) {
                 int r=0, c=0;
@@ -0,0 +1,225 @@
+/** ------------------------------------------------------------------------------------
+ * ConsoleC Display List Module Implementation
+ * ------------------------------------------------------------------------------------
+ * cc_displaylist.h 의 구현부입니다.
+ * 명령은 배열에, 문자열은 하나의 풀에 이어 붙여 저장하므로 다시 기록(clear 후 기록)할 때
+ * 메모리를 새로 할당하지 않습니다. 재생은 기존 cc_buffer 그리기 함수를 그대로 호출합니다.
+ * ------------------------------------------------------------------------------------ */
+
+#include "console_c/cc_displaylist.h"
+#include "console_c/cc_util.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+// -----------------------------------------------------------------------------
+// Internal Helpers
+// -----------------------------------------------------------------------------
+
+#define CC_DL_INIT_CMDS 16  /**< 명령 배열 초기 크기 */
+#define CC_DL_INIT_TEXT 256 /**< 문자열 풀 초기 크기 (bytes) */
+
+static cc_rect_t _rect_union( cc_rect_t a, cc_rect_t b )
+{
+    if( cc_rect_is_empty( a ) ) return b;
+    if( cc_rect_is_empty( b ) ) return a;
+
+    int x0 = ( a._x < b._x ) ? a._x : b._x;
+    int y0 = ( a._y < b._y ) ? a._y : b._y;
+    int x1 = ( a._x + a._w > b._x + b._w ) ? a._x + a._w : b._x + b._w;
+    int y1 = ( a._y + a._h > b._y + b._h ) ? a._y + a._h : b._y + b._h;
+    return cc_rect_make( x0, y0, x1 - x0, y1 - y0 );
+}
+
+static bool _is_rect_equal( cc_rect_t a, cc_rect_t b )
+{
+    return a._x == b._x && a._y == b._y && a._w == b._w && a._h == b._h;
+}
+
+/**
+ * @brief 명령 하나를 추가할 자리를 확보하고 0으로 초기화하여 반환
+ * @return 새 명령 (실패 시 NULL)
+ */
+static cc_dl_cmd_t* _push_cmd( cc_displaylist_t* self, cc_dl_op_e op, cc_rect_t bounds )
+{
+    if( self->_count >= self->_cap ){
+        int new_cap = ( self->_cap ) ? self->_cap * 2 : CC_DL_INIT_CMDS;
+        cc_dl_cmd_t* cmds = (cc_dl_cmd_t*)realloc( self->_cmds, sizeof( cc_dl_cmd_t ) * new_cap );
+        if( !cmds ) return NULL;
+        self->_cmds = cmds;
+        self->_cap  = new_cap;
+    }
+
+    cc_dl_cmd_t* cmd = &self->_cmds[self->_count++];
+    memset( cmd, 0, sizeof( cc_dl_cmd_t ) );
+    cmd->_op     = op;
+    cmd->_bounds = bounds;
+
+    self->_bounds = _rect_union( self->_bounds, bounds );
+    return cmd;
+}
+
+/**
+ * @brief 문자열을 풀에 복사
+ * @return 풀 내 위치 (실패 시 SIZE_MAX)
+ */
+static size_t _push_text( cc_displaylist_t* self, const char* text )
+{
+    size_t len = strlen( text ) + 1;
+    if( self->_text_len + len > self->_text_cap ){
+        size_t new_cap = ( self->_text_cap ) ? self->_text_cap : CC_DL_INIT_TEXT;
+        while( new_cap < self->_text_len + len ) new_cap *= 2;
+
+        char* pool = (char*)realloc( self->_text_pool, new_cap );
+        if( !pool ) return SIZE_MAX;
+        self->_text_pool = pool;
+        self->_text_cap  = new_cap;
+    }
+
+    size_t offset = self->_text_len;
+    memcpy( &self->_text_pool[offset], text, len );
+    self->_text_len += len;
+    return offset;
+}
+
+// -----------------------------------------------------------------------------
+// Public API Implementation
+// -----------------------------------------------------------------------------
+
+cc_displaylist_t* cc_displaylist_create( void )
+{
+    cc_displaylist_t* self = (cc_displaylist_t*)calloc( 1, sizeof( cc_displaylist_t ) );
+    return self;
+}
+
+void cc_displaylist_destroy( cc_displaylist_t* self )
+{
+    if( !self ) return;
+
+    free( self->_cmds );
+    free( self->_text_pool );
+    free( self );
+}
+
+void cc_displaylist_clear( cc_displaylist_t* self )
+{
+    if( !self ) return;
+
+    self->_count    = 0;
+    self->_text_len = 0;
+    self->_bounds   = cc_rect_make( 0, 0, 0, 0 );
+}
+
+bool cc_displaylist_draw_string( cc_displaylist_t* self, int x, int y, const char* text, const cc_color_t* fg, const cc_color_t* bg )
+{
+    if( !self || !text ) return false;
+
+    size_t offset = _push_text( self, text );
+    if( offset == SIZE_MAX ) return false;
+
+    // 문자열 너비만큼을 영역으로 (재생 시 다시 계산하지 않음)
+    int width = (int)cc_util_get_string_width( text );
+    cc_dl_cmd_t* cmd = _push_cmd( self, CC_DL_OP_STRING, cc_rect_make( x, y, width, 1 ) );
+    if( !cmd ){
+        self->_text_len = offset;
+        return false;
+    }
+
+    cmd->_x    = x;
+    cmd->_y    = y;
+    cmd->_text = offset;
+    cmd->_fg   = ( fg ) ? *fg : CC_COLOR_WHITE;
+    cmd->_bg   = ( bg ) ? *bg : CC_COLOR_BLACK;
+    return true;
+}
+
+bool cc_displaylist_draw_box( cc_displaylist_t* self, const cc_rect_t* rect, cc_box_style_e style, const cc_color_t* fg, const cc_color_t* bg, const cc_color_t* shadow )
+{
+    if( !self || !rect ) return false;
+
+    // 그림자는 오른쪽 2칸, 아래 1행까지 그림
+    cc_rect_t bounds = *rect;
+    if( shadow && !cc_rect_is_empty( bounds ) ){
+        bounds._w += 2;
+        bounds._h += 1;
+    }
+
+    cc_dl_cmd_t* cmd = _push_cmd( self, CC_DL_OP_BOX, bounds );
+    if( !cmd ) return false;
+
+    cmd->_rect       = *rect;
+    cmd->_style      = style;
+    cmd->_fg         = ( fg ) ? *fg : CC_COLOR_WHITE;
+    cmd->_bg         = ( bg ) ? *bg : CC_COLOR_BLACK;
+    cmd->_has_shadow = ( shadow != NULL );
+    if( shadow ) cmd->_shadow = *shadow;
+    return true;
+}
+
+bool cc_displaylist_fill_rect( cc_displaylist_t* self, const cc_rect_t* rect, const cc_cell_t* cell )
+{
+    if( !self || !rect || !cell ) return false;
+
+    cc_dl_cmd_t* cmd = _push_cmd( self, CC_DL_OP_FILL, *rect );
+    if( !cmd ) return false;
+
+    cmd->_rect = *rect;
+    cmd->_cell = *cell;
+    return true;
+}
+
+bool cc_displaylist_blit( cc_displaylist_t* self, int x, int y, const cc_buffer_t* src, const cc_rect_t* src_rect )
+{
+    if( !self || !src ) return false;
+
+    cc_rect_t area = ( src_rect ) ? *src_rect : cc_rect_make( 0, 0, src->_width, src->_height );
+
+    cc_dl_cmd_t* cmd = _push_cmd( self, CC_DL_OP_BLIT, cc_rect_make( x, y, area._w, area._h ) );
+    if( !cmd ) return false;
+
+    cmd->_x    = x;
+    cmd->_y    = y;
+    cmd->_rect = area;
+    cmd->_src  = src;
+    return true;
+}
+
+void cc_displaylist_replay( const cc_displaylist_t* self, cc_buffer_t* target, const cc_rect_t* area )
+{
+    if( !self || !target || self->_count == 0 ) return;
+
+    // 다시 그릴 영역 (버퍼 Clip과의 교집합)
+    cc_rect_t clip = cc_buffer_get_clip( target );
+    if( area ) clip = cc_rect_intersect( clip, *area );
+    if( cc_rect_is_empty( cc_rect_intersect( clip, self->_bounds ) ) ) return;
+
+    // Clip 스택이 가득 차 영역을 걸 수 없으면 영역 안에 완전히 들어가는 명령만 그림
+    // (걸치는 명령은 영역 밖까지 그리게 되므로 건너뜀)
+    bool pushed  = ( area != NULL ) && cc_buffer_push_clip( target, &clip );
+    bool inexact = ( area != NULL ) && !pushed;
+
+    for( int i = 0; i < self->_count; ++i ){
+        const cc_dl_cmd_t* cmd = &self->_cmds[i];
+        cc_rect_t overlap = cc_rect_intersect( cmd->_bounds, clip );
+        if( cc_rect_is_empty( overlap ) ) continue;
+        if( inexact && !_is_rect_equal( overlap, cmd->_bounds ) ) continue;
+
+        switch( cmd->_op ){
+            case CC_DL_OP_STRING:
+                cc_buffer_draw_string( target, cmd->_x, cmd->_y, &self->_text_pool[cmd->_text], &cmd->_fg, &cmd->_bg );
+                break;
+            case CC_DL_OP_BOX:
+                cc_buffer_draw_box_style( target, &cmd->_rect, cmd->_style, &cmd->_fg, &cmd->_bg, ( cmd->_has_shadow ) ? &cmd->_shadow : NULL );
+                break;
+            case CC_DL_OP_FILL:
+                cc_buffer_fill_rect( target, &cmd->_rect, &cmd->_cell );
+                break;
+            case CC_DL_OP_BLIT:
+                cc_buffer_blit( target, cmd->_x, cmd->_y, cmd->_src, &cmd->_rect );
+                break;
+        }
+    }
+
+    if( pushed ) cc_buffer_pop_clip( target );
+}
\ No newline at end of file
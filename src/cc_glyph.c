@@ -0,0 +1,234 @@
+/** ------------------------------------------------------------------------------------
+ * ConsoleC Glyph Module Implementation
+ * ------------------------------------------------------------------------------------
+ * cc_glyph.h 의 구현부입니다.
+ * 등록된 글자는 고정 크기 묶음(Chunk)에 저장하여 주소가 바뀌지 않으므로,
+ * ID로 조회할 때는 잠금 없이 읽고 등록할 때만 잠급니다.
+ * 등록은 묶음 포인터와 글자 내용을 모두 쓴 뒤 글자 수를 release로 늘리고,
+ * 조회는 글자 수를 acquire로 읽으므로 번호가 글자 수 안에 있으면 내용도 보입니다.
+ * ------------------------------------------------------------------------------------ */
+
+#include "console_c/cc_glyph.h"
+#include "console_c/cc_util.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+// -----------------------------------------------------------------------------
+// Internal Types & Globals
+// -----------------------------------------------------------------------------
+
+#define CC_GLYPH_CHUNK_SHIFT 10                              /**< 묶음당 글자 수 (1024) */
+#define CC_GLYPH_CHUNK_SIZE  ( 1 << CC_GLYPH_CHUNK_SHIFT )
+#define CC_GLYPH_CHUNK_MAX   4096                            /**< 최대 묶음 수 (글자 4M개) */
+#define CC_GLYPH_HASH_INIT   1024                            /**< 해시 표 초기 크기 (2의 거듭제곱) */
+
+/**
+ * @brief 등록된 글자 하나
+ */
+typedef struct
+{
+    uint8_t _len;                          /**< UTF-8 바이트 수 */
+    uint8_t _width;                        /**< 출력 너비 */
+    char    _bytes[CC_GLYPH_MAX_BYTES];    /**< UTF-8 바이트 */
+} glyph_entry_t;
+
+static pthread_mutex_t g_glyph_mtx = PTHREAD_MUTEX_INITIALIZER;
+
+static glyph_entry_t*   g_chunks[CC_GLYPH_CHUNK_MAX]; /**< 등록된 글자 (묶음 단위로 할당, 이동하지 않음) */
+static _Atomic uint32_t g_count = 0;                  /**< 등록된 글자 수 (잠금 없이 읽는 쪽에 공개된 수) */
+
+static uint32_t*        g_hash     = NULL; /**< 열린 주소 해시 표 (값 = 글자 번호 + 1, 0 = 빈 칸) */
+static uint32_t         g_hash_cap = 0;
+
+// -----------------------------------------------------------------------------
+// Internal Helpers
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief 잠금 없이 조회할 수 있는 글자 수 (이 수보다 작은 번호의 글자는 내용까지 보임)
+ */
+static uint32_t _published_count( void )
+{
+    return atomic_load_explicit( &g_count, memory_order_acquire );
+}
+
+static glyph_entry_t* _entry( uint32_t index )
+{
+    return &g_chunks[index >> CC_GLYPH_CHUNK_SHIFT][index & ( CC_GLYPH_CHUNK_SIZE - 1 )];
+}
+
+/**
+ * @brief FNV-1a 해시
+ */
+static uint32_t _hash_bytes( const char* bytes, size_t len )
+{
+    uint32_t h = 2166136261u;
+    for( size_t i = 0; i < len; ++i ){
+        h ^= (unsigned char)bytes[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+/**
+ * @brief 해시 표를 new_cap 크기로 다시 만듦 (잠금 상태에서 호출)
+ */
+static bool _rehash( uint32_t new_cap )
+{
+    uint32_t* table = (uint32_t*)calloc( new_cap, sizeof( uint32_t ) );
+    if( !table ) return false;
+
+    uint32_t count = atomic_load_explicit( &g_count, memory_order_relaxed );
+    for( uint32_t i = 0; i < count; ++i ){
+        const glyph_entry_t* e = _entry( i );
+        uint32_t slot = _hash_bytes( e->_bytes, e->_len ) & ( new_cap - 1 );
+        while( table[slot] ) slot = ( slot + 1 ) & ( new_cap - 1 );
+        table[slot] = i + 1;
+    }
+
+    free( g_hash );
+    g_hash     = table;
+    g_hash_cap = new_cap;
+    return true;
+}
+
+/**
+ * @brief 여러 코드포인트로 된 글자를 찾거나 새로 등록 (잠금 상태에서 호출)
+ * @return 글자 번호 (실패 시 UINT32_MAX)
+ */
+static uint32_t _find_or_add( const char* bytes, size_t len, int width )
+{
+    uint32_t count = atomic_load_explicit( &g_count, memory_order_relaxed );
+
+    // 부하율 1/2 이하 유지
+    if( ( count + 1 ) * 2 > g_hash_cap ){
+        if( !_rehash( g_hash_cap ? g_hash_cap * 2 : CC_GLYPH_HASH_INIT ) ) return UINT32_MAX;
+    }
+
+    uint32_t slot = _hash_bytes( bytes, len ) & ( g_hash_cap - 1 );
+    while( g_hash[slot] ){
+        const glyph_entry_t* e = _entry( g_hash[slot] - 1 );
+        if( e->_len == len && memcmp( e->_bytes, bytes, len ) == 0 ) return g_hash[slot] - 1;
+        slot = ( slot + 1 ) & ( g_hash_cap - 1 );
+    }
+
+    // 새 글자 (필요하면 묶음 할당)
+    uint32_t index = count;
+    uint32_t chunk = index >> CC_GLYPH_CHUNK_SHIFT;
+    if( chunk >= CC_GLYPH_CHUNK_MAX ) return UINT32_MAX;
+    if( !g_chunks[chunk] ){
+        g_chunks[chunk] = (glyph_entry_t*)malloc( sizeof( glyph_entry_t ) * CC_GLYPH_CHUNK_SIZE );
+        if( !g_chunks[chunk] ) return UINT32_MAX;
+    }
+
+    glyph_entry_t* e = _entry( index );
+    e->_len   = (uint8_t)len;
+    e->_width = (uint8_t)width;
+    memcpy( e->_bytes, bytes, len );
+
+    g_hash[slot] = index + 1;
+
+    // 묶음 포인터와 내용을 다 쓴 뒤 공개
+    atomic_store_explicit( &g_count, count + 1, memory_order_release );
+    return index;
+}
+
+/**
+ * @brief 글자를 코드포인트 경계에서 CC_GLYPH_MAX_BYTES 이하로 자름
+ */
+static size_t _truncate_cluster( const char* bytes, size_t len )
+{
+    size_t keep = 0;
+    while( keep < len ){
+        uint32_t cp = 0;
+        size_t   n  = (size_t)cc_util_decode_utf8( &bytes[keep], &cp );
+        if( keep + n > CC_GLYPH_MAX_BYTES ) break;
+        keep += n;
+    }
+    return keep;
+}
+
+/**
+ * @brief 너비를 이미 아는 글자를 글리프 ID로 변환
+ */
+static uint32_t _intern( const char* bytes, size_t len, int width )
+{
+    // 코드포인트 하나면 그대로 사용
+    uint32_t cp = 0;
+    int      n  = cc_util_decode_utf8( bytes, &cp );
+    if( cp == 0 ) return CC_GLYPH_REPLACEMENT;
+    if( (size_t)n >= len ) return cp;
+
+    len = _truncate_cluster( bytes, len );
+
+    pthread_mutex_lock( &g_glyph_mtx );
+    uint32_t index = _find_or_add( bytes, len, width );
+    pthread_mutex_unlock( &g_glyph_mtx );
+
+    return ( index == UINT32_MAX ) ? CC_GLYPH_REPLACEMENT : CC_GLYPH_CLUSTER_BASE + index;
+}
+
+// -----------------------------------------------------------------------------
+// Public API Implementation
+// -----------------------------------------------------------------------------
+
+int cc_glyph_decode( const char* text, uint32_t* out_glyph )
+{
+    int width = 0;
+    int len   = cc_util_next_cluster( text, &width );
+
+    if( out_glyph ){
+        // 대부분의 글자는 코드포인트 하나이므로 등록 없이 바로 반환
+        uint32_t cp = 0;
+        int      n  = ( len > 0 ) ? cc_util_decode_utf8( text, &cp ) : 0;
+        if( n == len ){
+            *out_glyph = ( cp == 0 ) ? CC_GLYPH_REPLACEMENT : cp;
+        } else {
+            *out_glyph = _intern( text, (size_t)len, width );
+        }
+    }
+    return len;
+}
+
+uint32_t cc_glyph_intern( const char* utf8, size_t len )
+{
+    if( !utf8 || len == 0 ) return CC_GLYPH_REPLACEMENT;
+
+    char buf[CC_GLYPH_MAX_BYTES + 1];
+    if( len > CC_GLYPH_MAX_BYTES ) len = _truncate_cluster( utf8, len );
+    memcpy( buf, utf8, len );
+    buf[len] = '\0';
+
+    int width = 0;
+    cc_util_next_cluster( buf, &width );
+    return _intern( buf, len, width );
+}
+
+int cc_glyph_width( uint32_t glyph )
+{
+    if( !CC_GLYPH_IS_CLUSTER( glyph ) ) return cc_util_get_codepoint_width( glyph );
+    if( glyph - CC_GLYPH_CLUSTER_BASE >= _published_count() ) return 1;
+    return _entry( glyph - CC_GLYPH_CLUSTER_BASE )->_width;
+}
+
+int cc_glyph_encode( uint32_t glyph, char* out_buf )
+{
+    if( !CC_GLYPH_IS_CLUSTER( glyph ) ) return cc_util_encode_utf8( glyph, out_buf );
+    if( glyph - CC_GLYPH_CLUSTER_BASE >= _published_count() ) return cc_util_encode_utf8( CC_GLYPH_REPLACEMENT, out_buf );
+
+    const glyph_entry_t* e = _entry( glyph - CC_GLYPH_CLUSTER_BASE );
+    memcpy( out_buf, e->_bytes, e->_len );
+    return e->_len;
+}
+
+int cc_glyph_byte_length( uint32_t glyph )
+{
+    if( !CC_GLYPH_IS_CLUSTER( glyph ) ){
+        return ( glyph < 0x80 ) ? 1 : ( glyph < 0x800 ) ? 2 : ( glyph < 0x10000 ) ? 3 : 4;
+    }
+    if( glyph - CC_GLYPH_CLUSTER_BASE >= _published_count() ) return 3;
+    return _entry( glyph - CC_GLYPH_CLUSTER_BASE )->_len;
+}
\ No newline at end of file
@@ -0,0 +1,366 @@
+/** ------------------------------------------------------------------------------------
+ * ConsoleC Layer Compositor Module Implementation
+ * ------------------------------------------------------------------------------------
+ * cc_layer.h 의 구현부입니다.
+ * 한 행의 변경 범위를 아래 레이어부터 임시 행에 겹쳐 그린 뒤,
+ * 2칸 문자 짝을 정리하여 cc_buffer_write_cells 로 대상 버퍼에 기록합니다.
+ * ------------------------------------------------------------------------------------ */
+
+#include "console_c/cc_layer.h"
+#include "console_c/cc_glyph.h"
+#include "cc_buffer_internal.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+
+// -----------------------------------------------------------------------------
+// Internal Helpers
+// -----------------------------------------------------------------------------
+
+static bool _is_trail( const cc_cell_t* cell )
+{
+    return ( CELL_FLAGS( cell ) & CC_CELL_FLAG_WIDE_TRAIL ) != 0;
+}
+
+static bool _is_lead( const cc_cell_t* cell )
+{
+    return !_is_trail( cell ) && cc_glyph_width( CELL_GLYPH( cell ) ) == 2;
+}
+
+static bool _is_rect_equal( cc_rect_t a, cc_rect_t b )
+{
+    return a._x == b._x && a._y == b._y && a._w == b._w && a._h == b._h;
+}
+
+/**
+ * @brief 화면 y행의 [x0, x1] 범위를 다시 합성하도록 기록 (범위는 화면 안으로 보정)
+ */
+static void _damage_span( cc_compositor_t* self, int y, int x0, int x1 )
+{
+    if( y < 0 || y >= self->_height ) return;
+    if( x0 < 0 ) x0 = 0;
+    if( x1 >= self->_width ) x1 = self->_width - 1;
+    if( x0 > x1 ) return;
+
+    cc_dirty_span_t* span = &self->_damage[y];
+    if( x0 < span->_min_x ) span->_min_x = x0;
+    if( x1 > span->_max_x ) span->_max_x = x1;
+}
+
+static void _damage_rect( cc_compositor_t* self, cc_rect_t rect )
+{
+    if( cc_rect_is_empty( rect ) ) return;
+    for( int y = rect._y; y < rect._y + rect._h; ++y ){
+        _damage_span( self, y, rect._x, rect._x + rect._w - 1 );
+    }
+}
+
+/**
+ * @brief 대상 버퍼 크기에 맞춰 변경 범위 배열을 준비 (크기가 바뀌면 전체를 다시 합성)
+ */
+static bool _sync_target_size( cc_compositor_t* self )
+{
+    const cc_buffer_t* target = self->_target;
+    if( target->_width == self->_width && target->_height == self->_height ) return true;
+
+    cc_dirty_span_t* damage = (cc_dirty_span_t*)realloc( self->_damage, sizeof( cc_dirty_span_t ) * target->_height );
+    if( !damage ) return false;
+    self->_damage = damage;
+
+    // 양옆 2칸의 문맥까지 합성하므로 여유를 둠
+    if( target->_width + 4 > self->_row_cap ){
+        cc_cell_t* row = (cc_cell_t*)realloc( self->_row, sizeof( cc_cell_t ) * ( target->_width + 4 ) );
+        if( !row ) return false;
+        self->_row     = row;
+        self->_row_cap = target->_width + 4;
+    }
+
+    self->_width  = target->_width;
+    self->_height = target->_height;
+    cc_compositor_invalidate( self );
+    return true;
+}
+
+/**
+ * @brief 레이어를 _z 순으로 정렬 (안정 삽입 정렬, 레이어 수가 적고 대부분 이미 정렬됨)
+ */
+static void _sort_layers( cc_compositor_t* self )
+{
+    for( int i = 1; i < self->_layer_count; ++i ){
+        cc_layer_t* layer = self->_layers[i];
+        int j = i - 1;
+        while( j >= 0 && self->_layers[j]->_z > layer->_z ){
+            self->_layers[j + 1] = self->_layers[j];
+            --j;
+        }
+        self->_layers[j + 1] = layer;
+    }
+}
+
+/**
+ * @brief 레이어 버퍼의 변경 행을 화면 좌표의 손상 범위로 옮길 때 넘기는 값
+ */
+typedef struct
+{
+    cc_compositor_t*  _compositor;
+    const cc_layer_t* _layer;
+} layer_damage_ctx_t;
+
+static void _damage_surface_span( void* user, int y, int min_x, int max_x )
+{
+    const layer_damage_ctx_t* ctx = (const layer_damage_ctx_t*)user;
+    _damage_span( ctx->_compositor, ctx->_layer->_y + y, ctx->_layer->_x + min_x, ctx->_layer->_x + max_x );
+}
+
+/**
+ * @brief 레이어의 변경 사항을 화면 변경 범위로 옮기고, 레이어 버퍼의 변경 기록을 비움
+ * @details 위치/크기/표시/순서가 바뀌었으면 이전 영역과 현재 영역 전체를,
+ * 아니면 레이어 버퍼의 Dirty Span만 화면 좌표로 옮겨 기록합니다.
+ */
+static void _collect_layer_damage( cc_compositor_t* self, cc_layer_t* layer )
+{
+    cc_buffer_t* surface = layer->_surface;
+    cc_rect_t    rect    = layer->_visible ? cc_rect_make( layer->_x, layer->_y, surface->_width, surface->_height )
+                                           : cc_rect_make( 0, 0, 0, 0 );
+
+    // 버퍼 전체 너비 스크롤은 옮긴 행을 변경으로 기록하지 않으므로 (터미널 스크롤 명령으로 처리) 전체를 다시 합성
+    bool scrolled = cc_buffer_take_scroll( surface );
+
+    // 레이어 버퍼는 flush 하지 않으므로 여기서 변경 기록을 꺼내 비움
+    if( scrolled || !_is_rect_equal( rect, layer->_shown_rect ) || layer->_z != layer->_shown_z ){
+        _damage_rect( self, layer->_shown_rect );
+        _damage_rect( self, rect );
+        cc_buffer_take_dirty( surface, NULL, NULL );
+    }
+    else if( !cc_rect_is_empty( rect ) ){
+        layer_damage_ctx_t ctx = { self, layer };
+        cc_buffer_take_dirty( surface, _damage_surface_span, &ctx );
+    }
+    else{
+        cc_buffer_take_dirty( surface, NULL, NULL );
+    }
+
+    layer->_shown_rect = rect;
+    layer->_shown_z    = layer->_z;
+}
+
+/**
+ * @brief 위 셀(src)을 아래 셀(dst) 위에 겹침
+ * @details 배경이 투명한 공백은 건너뛰고, 투명한 색은 아래 셀의 색을 유지합니다.
+ */
+static void _blend_cell( cc_cell_t* dst, const cc_cell_t* src )
+{
+    bool bg_none = COLOR_TYPE( src->_bg ) == CC_COLOR_TYPE_NONE;
+    if( bg_none && src->_glyph == ' ' ) return;
+
+    dst->_glyph = src->_glyph;
+    if( COLOR_TYPE( src->_fg ) != CC_COLOR_TYPE_NONE ) dst->_fg = src->_fg;
+    if( !bg_none ) dst->_bg = src->_bg;
+}
+
+/**
+ * @brief 화면 y행의 [x0, x1] 범위를 합성하여 대상 버퍼에 기록
+ * @details 짝이 맞는지 판단하기 위해 양옆 2칸까지 합성한 뒤,
+ * 위 레이어에 가려 짝을 잃은 2칸 문자 조각을 공백으로 바꿉니다.
+ * 기록 범위가 2칸 문자를 가르지 않도록 경계의 짝까지 포함하여 기록합니다.
+ */
+static void _compose_span( cc_compositor_t* self, int y, int x0, int x1 )
+{
+    int lo = ( x0 - 2 > 0 ) ? x0 - 2 : 0;
+    int hi = ( x1 + 2 < self->_width - 1 ) ? x1 + 2 : self->_width - 1;
+    cc_cell_t* row = self->_row; // row[i] = 화면 (lo + i, y)
+
+    for( int x = lo; x <= hi; ++x ) row[x - lo] = self->_base;
+
+    // 1. 아래 레이어부터 겹침
+    for( int i = 0; i < self->_layer_count; ++i ){
+        const cc_layer_t* layer = self->_layers[i];
+        cc_rect_t r = layer->_shown_rect;
+        if( y < r._y || y >= r._y + r._h ) continue;
+
+        int from = ( r._x > lo ) ? r._x : lo;
+        int to   = ( r._x + r._w - 1 < hi ) ? r._x + r._w - 1 : hi;
+        const cc_cell_t* src = &layer->_surface->_back_buffer[( y - r._y ) * r._w];
+        for( int x = from; x <= to; ++x ){
+            _blend_cell( &row[x - lo], &src[x - r._x] );
+        }
+    }
+
+    // 2. 짝을 잃은 Lead/Trail 정리 (판단은 정리 전 값 기준, 화면 밖은 짝이 없는 것으로 봄)
+    int fix_from = ( lo == 0 ) ? 0 : lo + 1;
+    int fix_to   = ( hi == self->_width - 1 ) ? hi : hi - 1;
+    bool prev_lead = ( fix_from > lo ) && _is_lead( &row[fix_from - 1 - lo] );
+    for( int x = fix_from; x <= fix_to; ++x ){
+        cc_cell_t* cell = &row[x - lo];
+        bool lead       = _is_lead( cell );
+        bool next_trail = ( x < hi ) && _is_trail( &row[x + 1 - lo] );
+
+        if( ( _is_trail( cell ) && !prev_lead ) || ( lead && !next_trail ) ) cell->_glyph = ' ';
+        prev_lead = lead;
+    }
+
+    // 3. 경계의 2칸 문자는 짝까지 함께 기록
+    if( _is_trail( &row[x0 - lo] ) ) --x0;
+    if( _is_lead( &row[x1 - lo] ) ) ++x1;
+
+    // 앱이 대상 버퍼에 쌓아둔 Clip과 관계없이 기록 (잘리면 변경 기록만 지워져 화면에 다시 반영되지 않음)
+    cc_buffer_write_cells_unclipped( self->_target, x0, y, &row[x0 - lo], x1 - x0 + 1 );
+}
+
+static void _layer_free( cc_layer_t* layer )
+{
+    if( !layer ) return;
+    cc_buffer_destroy( layer->_surface );
+    free( layer );
+}
+
+// -----------------------------------------------------------------------------
+// Public API Implementation
+// -----------------------------------------------------------------------------
+
+cc_compositor_t* cc_compositor_create( cc_buffer_t* target, const cc_color_t* background )
+{
+    if( !target ) return NULL;
+
+    cc_compositor_t* self = (cc_compositor_t*)calloc( 1, sizeof( cc_compositor_t ) );
+    if( !self ) return NULL;
+
+    self->_target = target;
+    cc_cell_init( &self->_base, ' ', &CC_COLOR_WHITE, ( background ) ? background : &CC_COLOR_BLACK );
+
+    if( !_sync_target_size( self ) ){
+        cc_compositor_destroy( self );
+        return NULL;
+    }
+    return self;
+}
+
+void cc_compositor_destroy( cc_compositor_t* self )
+{
+    if( !self ) return;
+
+    for( int i = 0; i < self->_layer_count; ++i ){
+        _layer_free( self->_layers[i] );
+    }
+    if( self->_layers ) free( self->_layers );
+    if( self->_damage ) free( self->_damage );
+    if( self->_row )    free( self->_row );
+
+    free( self );
+}
+
+cc_layer_t* cc_compositor_add_layer( cc_compositor_t* self, const cc_rect_t* rect, int z )
+{
+    if( !self || !rect ) return NULL;
+
+    if( self->_layer_count == self->_layer_cap ){
+        int          cap    = ( self->_layer_cap > 0 ) ? self->_layer_cap * 2 : 8;
+        cc_layer_t** layers = (cc_layer_t**)realloc( self->_layers, sizeof( cc_layer_t* ) * cap );
+        if( !layers ) return NULL;
+        self->_layers    = layers;
+        self->_layer_cap = cap;
+    }
+
+    cc_layer_t* layer = (cc_layer_t*)calloc( 1, sizeof( cc_layer_t ) );
+    if( !layer ) return NULL;
+
+    layer->_surface = cc_buffer_create( rect->_w, rect->_h );
+    if( !layer->_surface ){
+        free( layer );
+        return NULL;
+    }
+    cc_buffer_clear( layer->_surface, &CC_COLOR_NONE );
+
+    layer->_x       = rect->_x;
+    layer->_y       = rect->_y;
+    layer->_z       = z;
+    layer->_visible = true;
+    layer->_shown_rect = cc_rect_make( 0, 0, 0, 0 ); // 첫 compose 때 전체 영역을 합성
+    layer->_shown_z    = z;
+
+    self->_layers[self->_layer_count++] = layer;
+    return layer;
+}
+
+void cc_compositor_remove_layer( cc_compositor_t* self, cc_layer_t* layer )
+{
+    if( !self || !layer ) return;
+
+    for( int i = 0; i < self->_layer_count; ++i ){
+        if( self->_layers[i] != layer ) continue;
+
+        if( self->_damage ) _damage_rect( self, layer->_shown_rect );
+        memmove( &self->_layers[i], &self->_layers[i + 1], sizeof( cc_layer_t* ) * ( self->_layer_count - i - 1 ) );
+        self->_layer_count--;
+        _layer_free( layer );
+        return;
+    }
+}
+
+void cc_compositor_invalidate( cc_compositor_t* self )
+{
+    if( !self || !self->_damage ) return;
+
+    for( int y = 0; y < self->_height; ++y ){
+        self->_damage[y]._min_x = 0;
+        self->_damage[y]._max_x = self->_width - 1;
+    }
+}
+
+void cc_compositor_compose( cc_compositor_t* self )
+{
+    if( !self || !self->_target->_back_buffer ) return;
+    if( !_sync_target_size( self ) ) return;
+
+    _sort_layers( self );
+    for( int i = 0; i < self->_layer_count; ++i ){
+        _collect_layer_damage( self, self->_layers[i] );
+    }
+
+    for( int y = 0; y < self->_height; ++y ){
+        cc_dirty_span_t* span = &self->_damage[y];
+        if( span->_min_x > span->_max_x ) continue;
+
+        _compose_span( self, y, span->_min_x, span->_max_x );
+        span->_min_x = INT_MAX;
+        span->_max_x = -1;
+    }
+}
+
+void cc_layer_move( cc_layer_t* self, int x, int y )
+{
+    if( !self ) return;
+    self->_x = x;
+    self->_y = y;
+}
+
+bool cc_layer_resize( cc_layer_t* self, int width, int height )
+{
+    if( !self ) return false;
+
+    int old_w = self->_surface->_width;
+    int old_h = self->_surface->_height;
+    if( !cc_buffer_resize( self->_surface, width, height ) ) return false;
+
+    // 새로 드러난 영역은 투명하게 (표면에 쌓인 Clip과 관계없이)
+    cc_cell_t clear;
+    cc_cell_init( &clear, ' ', &CC_COLOR_WHITE, &CC_COLOR_NONE );
+    cc_rect_t right  = cc_rect_make( old_w, 0, width - old_w, height );
+    cc_rect_t bottom = cc_rect_make( 0, old_h, width, height - old_h );
+    cc_buffer_fill_rect_unclipped( self->_surface, &right, &clear );
+    cc_buffer_fill_rect_unclipped( self->_surface, &bottom, &clear );
+    return true;
+}
+
+void cc_layer_set_z( cc_layer_t* self, int z )
+{
+    if( !self ) return;
+    self->_z = z;
+}
+
+void cc_layer_set_visible( cc_layer_t* self, bool visible )
+{
+    if( !self ) return;
+    self->_visible = visible;
+}
\ No newline at end of file
@@ -0,0 +1,45 @@
+/** ------------------------------------------------------------------------------------
+ * ConsoleC Rect Module Implementation
+ * ------------------------------------------------------------------------------------
+ * cc_rect.h 의 구현부입니다.
+ * ------------------------------------------------------------------------------------ */
+
+#include "console_c/cc_rect.h"
+
+// -----------------------------------------------------------------------------
+// Public API Implementation
+// -----------------------------------------------------------------------------
+
+cc_rect_t cc_rect_make( int x, int y, int w, int h )
+{
+    cc_rect_t res;
+    res._x = x;
+    res._y = y;
+    res._w = w;
+    res._h = h;
+    return res;
+}
+
+bool cc_rect_is_empty( cc_rect_t r )
+{
+    return ( r._w <= 0 ) || ( r._h <= 0 );
+}
+
+cc_rect_t cc_rect_intersect( cc_rect_t a, cc_rect_t b )
+{
+    int x0 = ( a._x > b._x ) ? a._x : b._x;
+    int y0 = ( a._y > b._y ) ? a._y : b._y;
+    int x1 = ( a._x + a._w < b._x + b._w ) ? a._x + a._w : b._x + b._w;
+    int y1 = ( a._y + a._h < b._y + b._h ) ? a._y + a._h : b._y + b._h;
+
+    if( x1 <= x0 || y1 <= y0 ){
+        return cc_rect_make( x0, y0, 0, 0 );
+    }
+    return cc_rect_make( x0, y0, x1 - x0, y1 - y0 );
+}
+
+bool cc_rect_contains( cc_rect_t r, int x, int y )
+{
+    return ( x >= r._x ) && ( x < r._x + r._w ) &&
+           ( y >= r._y ) && ( y < r._y + r._h );
+}
\ No newline at end of file
@@ -0,0 +1,157 @@
+/** ------------------------------------------------------------------------------------
+ * ConsoleC Frame Scheduler Module Implementation
+ * ------------------------------------------------------------------------------------
+ * cc_scheduler.h 의 구현부입니다.
+ * 대기는 모두 cc_device_get_input 의 타임아웃(select)으로 처리합니다.
+ * ------------------------------------------------------------------------------------ */
+
+// Feature Test Macros (for clock_gettime)
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include "console_c/cc_scheduler.h"
+
+#include <time.h>
+
+// -----------------------------------------------------------------------------
+// Internal Helpers
+// -----------------------------------------------------------------------------
+
+#define NS_PER_MS  1000000LL
+#define NS_PER_SEC 1000000000LL
+
+/**
+ * @brief 현재 시각 (CLOCK_MONOTONIC, 나노초)
+ */
+static int64_t _now_ns( void )
+{
+    struct timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return (int64_t)ts.tv_sec * NS_PER_SEC + ts.tv_nsec;
+}
+
+/**
+ * @brief 나노초 간격을 밀리초 타임아웃으로 변환 (올림: 일찍 깨어나 헛도는 것을 방지)
+ */
+static int _to_timeout_ms( int64_t ns )
+{
+    if( ns <= 0 ) return 0;
+
+    int64_t ms = ( ns + NS_PER_MS - 1 ) / NS_PER_MS;
+    return ( ms > 0x7FFFFFFF ) ? 0x7FFFFFFF : (int)ms;
+}
+
+/**
+ * @brief 예약 시각이 지났으면 다시 그리기 요청으로 전환
+ */
+static void _promote_wake( cc_scheduler_t* self, int64_t now )
+{
+    if( self->_wake_at > 0 && now >= self->_wake_at ){
+        self->_wake_at = 0;
+        self->_redraw  = true;
+    }
+}
+
+/**
+ * @brief 다음 프레임을 그릴 수 있는 가장 이른 시각
+ */
+static int64_t _next_frame_at( const cc_scheduler_t* self )
+{
+    if( self->_frame_interval <= 0 || self->_last_frame == 0 ) return 0;
+    return self->_last_frame + self->_frame_interval;
+}
+
+// -----------------------------------------------------------------------------
+// Public API Implementation
+// -----------------------------------------------------------------------------
+
+void cc_scheduler_init( cc_scheduler_t* self, int target_fps )
+{
+    if( !self ) return;
+
+    self->_last_frame  = 0;
+    self->_wake_at     = 0;
+    self->_redraw      = true;
+    self->_batch       = 0;
+    self->_frame_count = 0;
+    cc_scheduler_set_fps( self, target_fps );
+}
+
+void cc_scheduler_set_fps( cc_scheduler_t* self, int target_fps )
+{
+    if( !self ) return;
+    self->_frame_interval = ( target_fps > 0 ) ? NS_PER_SEC / target_fps : 0;
+}
+
+void cc_scheduler_request_redraw( cc_scheduler_t* self )
+{
+    if( !self ) return;
+    self->_redraw = true;
+}
+
+void cc_scheduler_request_redraw_after( cc_scheduler_t* self, int delay_ms )
+{
+    if( !self ) return;
+
+    if( delay_ms <= 0 ){
+        self->_redraw = true;
+        return;
+    }
+
+    int64_t at = _now_ns() + (int64_t)delay_ms * NS_PER_MS;
+    if( self->_wake_at == 0 || at < self->_wake_at ){
+        self->_wake_at = at;
+    }
+}
+
+cc_key_code_e cc_scheduler_wait( cc_scheduler_t* self )
+{
+    if( !self ) return CC_KEY_NONE;
+
+    int64_t now = _now_ns();
+    _promote_wake( self, now );
+
+    int64_t next_frame = _next_frame_at( self );
+    bool    due        = self->_redraw && now >= next_frame;
+
+    // 1. 그릴 차례여도 이미 도착한 입력은 먼저 모두 처리 (입력 묶음을 한 프레임으로 합침)
+    // 입력이 끝없이 이어져도 화면이 멈추지 않도록 일정 수 이상이면 그리기를 먼저 함
+    if( due ){
+        if( self->_batch >= CC_SCHEDULER_MAX_BATCH ) return CC_KEY_NONE;
+
+        cc_key_code_e key = cc_device_get_input( 0 );
+        if( key != CC_KEY_NONE ) self->_batch++;
+        return key;
+    }
+
+    // 2. 다음 프레임 시각(또는 예약 시각)까지 입력을 받으며 대기
+    int timeout_ms = -1;
+    if( self->_redraw ){
+        timeout_ms = _to_timeout_ms( next_frame - now );
+    }
+    else if( self->_wake_at > 0 ){
+        timeout_ms = _to_timeout_ms( self->_wake_at - now );
+    }
+
+    cc_key_code_e key = cc_device_get_input( timeout_ms );
+    if( key != CC_KEY_NONE ) self->_batch++;
+    return key;
+}
+
+bool cc_scheduler_begin_frame( cc_scheduler_t* self )
+{
+    if( !self ) return false;
+
+    int64_t now = _now_ns();
+    _promote_wake( self, now );
+
+    if( !self->_redraw || now < _next_frame_at( self ) ) return false;
+
+    // 놓친 프레임 시각은 따라잡지 않음 (지금을 새 기준으로)
+    self->_redraw     = false;
+    self->_batch      = 0;
+    self->_last_frame = now;
+    self->_frame_count++;
+    return true;
+}
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include "console_c/cc_screen.h"
 
 #include <stdio.h>
+#include <string.h>
 #include <unistd.h>
 #include <sys/ioctl.h>
 
@@ -16,6 +17,8 @@
 const cc_coord_t CC_COORD_ZERO   = { 0, 0 };
 const cc_coord_t CC_COORD_ORIGIN = { 0, 0 };
 
+static cc_sink_t* _screen_sink = NULL; /**< cc_screen_* 출력 Sink (NULL = stdio 표준 출력) */
+
 // -----------------------------------------------------------------------------
 // Internal Helpers
 // -----------------------------------------------------------------------------
@@ -43,10 +46,30 @@ static cc_coord_t _clamp_to_terminal( cc_coord_t pos )
     return safe_pos;
 }
 
+/**
+ * @brief 제어 시퀀스 출력 (Sink가 없으면 printf와 같이 stdio 버퍼를 거침)
+ */
+static void _emit( const char* seq, int len )
+{
+    if( len <= 0 ) return;
+
+    if( _screen_sink ) cc_sink_write( _screen_sink, seq, (size_t)len );
+    else               fwrite( seq, 1, (size_t)len, stdout );
+}
+
 // -----------------------------------------------------------------------------
 // Public API Implementation
 // -----------------------------------------------------------------------------
 
+void cc_screen_set_sink( cc_sink_t* sink )
+{
+    if( sink == _screen_sink ) return;
+
+    // 바꾸기 전까지 stdio에 쌓인 출력은 원래 순서대로 내보냄
+    if( !_screen_sink ) fflush( stdout );
+    _screen_sink = ( sink == cc_sink_stdout() ) ? NULL : sink;
+}
+
 cc_term_size_t cc_screen_get_size( void )
 {
     struct winsize ws;
@@ -81,7 +104,8 @@ bool cc_screen_move_cursor_v( cc_coord_t pos )
 
     // 핵심: 사용자(0-based) -> ANSI(1-based) 변환
     // \033[<Row>;<Col>H
-    printf( "\033[%d;%dH", safe_pos._y + 1, safe_pos._x + 1 );
+    char seq[32];
+    _emit( seq, snprintf( seq, sizeof(seq), "\033[%d;%dH", safe_pos._y + 1, safe_pos._x + 1 ) );
 
     return true;
 }
@@ -90,17 +114,21 @@ void cc_screen_move_cursor_relative( int dx, int dy )
 {
     if( dx == 0 && dy == 0 ) return;
 
-    if( dy < 0 ) printf( "\033[%dA", -dy ); // Up
-    if( dy > 0 ) printf( "\033[%dB",  dy ); // Down
-    if( dx > 0 ) printf( "\033[%dC",  dx ); // Right
-    if( dx < 0 ) printf( "\033[%dD", -dx ); // Left
+    char seq[32];
+    if( dy < 0 ) _emit( seq, snprintf( seq, sizeof(seq), "\033[%dA", -dy ) ); // Up
+    if( dy > 0 ) _emit( seq, snprintf( seq, sizeof(seq), "\033[%dB",  dy ) ); // Down
+    if( dx > 0 ) _emit( seq, snprintf( seq, sizeof(seq), "\033[%dC",  dx ) ); // Right
+    if( dx < 0 ) _emit( seq, snprintf( seq, sizeof(seq), "\033[%dD", -dx ) ); // Left
 }
 
 void cc_screen_clear( void )
 {
     // 2J: 화면 전체 지우기, 1;1H: 커서 홈 이동
-    printf( "\033[2J\033[1;1H" );
-    fflush( stdout );
+    static const char seq[] = "\033[2J\033[1;1H";
+    _emit( seq, (int)sizeof(seq) - 1 );
+
+    if( _screen_sink ) cc_sink_flush( _screen_sink );
+    else               fflush( stdout );
 }
 
 bool cc_screen_set_color( const cc_color_t* color )
@@ -111,7 +139,7 @@ bool cc_screen_set_color( const cc_color_t* color )
 
     char buf[64];
     if( cc_color_to_ansi_fg( color, buf, sizeof(buf) ) ){
-        printf( "%s", buf );
+        _emit( buf, (int)strlen( buf ) );
         return true;
     }
     return false;
@@ -125,7 +153,7 @@ bool cc_screen_set_back_color( const cc_color_t* color )
 
     char buf[64];
     if( cc_color_to_ansi_bg( color, buf, sizeof(buf) ) ){
-        printf( "%s", buf );
+        _emit( buf, (int)strlen( buf ) );
         return true;
     }
     return false;
@@ -136,7 +164,7 @@ void cc_screen_reset_color( void )
     char buf[64];
     // CC_COLOR_RESET은 extern const이므로 주소 전달
     if( cc_color_to_ansi_fg( &CC_COLOR_RESET, buf, sizeof(buf) ) ){
-        printf( "%s", buf );
+        _emit( buf, (int)strlen( buf ) );
     }
 }
 
@@ -0,0 +1,353 @@
+/** ------------------------------------------------------------------------------------
+ * ConsoleC Sink Module Implementation
+ * ------------------------------------------------------------------------------------
+ * cc_sink.h 의 구현부입니다.
+ * 기본 제공 Sink는 모두 cc_sink_t 를 첫 멤버로 가지며, 동작 테이블로 구분합니다.
+ * ------------------------------------------------------------------------------------ */
+
+// Feature Test Macros (for IOV_MAX)
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include "console_c/cc_sink.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <errno.h>
+#include <unistd.h>
+#include <stdatomic.h>
+#include <sys/select.h>
+
+// -----------------------------------------------------------------------------
+// Fd Sink
+// -----------------------------------------------------------------------------
+
+#define CC_SINK_WAIT_SLICE_MS 100 /**< 막힌 출력을 기다리는 단위 (중단 요청 확인 주기) */
+
+typedef struct
+{
+    cc_sink_t   _base;
+    int         _fd;
+    bool        _owns_fd;
+    bool        _stdio;       /**< 쓰기 전에 stdout stdio 버퍼를 먼저 내보냄 (표준 출력 Sink) */
+    atomic_bool _interrupted; /**< 중단 요청 (cc_sink_interrupt) */
+} fd_sink_t;
+
+/**
+ * @brief Non-blocking fd가 쓸 수 있게 될 때까지 대기
+ * @details CC_SINK_WAIT_SLICE_MS 단위로 나눠 기다리며 그 사이 중단 요청을 확인합니다.
+ * @return 쓸 수 있음 (중단 요청 시 false)
+ */
+static bool _wait_writable( fd_sink_t* self )
+{
+    while( !atomic_load( &self->_interrupted ) ){
+        fd_set writefds;
+        FD_ZERO( &writefds );
+        FD_SET( self->_fd, &writefds );
+
+        struct timeval timeout = { 0, CC_SINK_WAIT_SLICE_MS * 1000 };
+        int ready = select( self->_fd + 1, NULL, &writefds, NULL, &timeout );
+        if( ready > 0 ) return true;
+        if( ready < 0 && errno != EINTR ) return true; // write가 오류를 보고하도록
+    }
+    return false;
+}
+
+/**
+ * @brief data를 fd로 끝까지 전송 (부분 쓰기/EINTR/EAGAIN은 이어서 재시도)
+ * @return 성공 여부 (출력이 닫히는 등 복구할 수 없는 오류나 중단 요청 시 false)
+ */
+static bool _write_all( fd_sink_t* self, const char* data, size_t len )
+{
+    while( len > 0 ){
+        ssize_t n = write( self->_fd, data, len );
+        if( n > 0 ){
+            data += n;
+            len  -= (size_t)n;
+            continue;
+        }
+        if( n < 0 && errno == EINTR ) continue;
+        if( n < 0 && ( errno == EAGAIN || errno == EWOULDBLOCK ) ){
+            if( !_wait_writable( self ) ) return false;
+            continue;
+        }
+        return false;
+    }
+    return true;
+}
+
+static bool _fd_write( cc_sink_t* base, const char* data, size_t len )
+{
+    fd_sink_t* self = (fd_sink_t*)base;
+    if( len == 0 ) return true;
+
+    // 앞서 printf 등으로 쌓인 출력을 먼저 내보내 순서를 유지
+    if( self->_stdio ) fflush( stdout );
+    return _write_all( self, data, len );
+}
+
+/**
+ * @brief 조각들을 writev로 전송
+ * @details 한 번에 IOV_MAX 개씩 보내고, 조각 중간에서 끊기면 그 조각의 나머지는 write로 마저 보냅니다.
+ */
+static bool _fd_writev( cc_sink_t* base, const struct iovec* iov, int iovcnt )
+{
+    fd_sink_t* self = (fd_sink_t*)base;
+    if( self->_stdio ) fflush( stdout );
+
+    while( iovcnt > 0 ){
+        int     batch = ( iovcnt > IOV_MAX ) ? IOV_MAX : iovcnt;
+        ssize_t n     = writev( self->_fd, iov, batch );
+        if( n < 0 ){
+            if( errno == EINTR ) continue;
+            if( errno == EAGAIN || errno == EWOULDBLOCK ){
+                if( !_wait_writable( self ) ) return false;
+                continue;
+            }
+            return false;
+        }
+
+        // 다 보낸 조각 건너뛰기
+        size_t done = (size_t)n;
+        int    skip = 0;
+        while( skip < batch && done >= iov[skip].iov_len ){
+            done -= iov[skip].iov_len;
+            ++skip;
+        }
+        if( skip < batch && done > 0 ){
+            if( !_write_all( self, (const char*)iov[skip].iov_base + done, iov[skip].iov_len - done ) ) return false;
+            ++skip;
+        }
+        else if( skip == 0 ){
+            return false; // 아무것도 보내지 못함
+        }
+
+        iov    += skip;
+        iovcnt -= skip;
+    }
+    return true;
+}
+
+static void _fd_interrupt( cc_sink_t* base, bool interrupt )
+{
+    fd_sink_t* self = (fd_sink_t*)base;
+    atomic_store( &self->_interrupted, interrupt );
+}
+
+static void _fd_destroy( cc_sink_t* base )
+{
+    fd_sink_t* self = (fd_sink_t*)base;
+    if( self->_owns_fd ) close( self->_fd );
+    free( self );
+}
+
+static const cc_sink_ops_t _FD_OPS = { _fd_write, _fd_writev, NULL, _fd_interrupt, _fd_destroy };
+
+static fd_sink_t _stdout_sink = { { &_FD_OPS }, STDOUT_FILENO, false, true, false };
+
+// -----------------------------------------------------------------------------
+// Memory Sink
+// -----------------------------------------------------------------------------
+
+#define CC_SINK_MEMORY_INIT_CAP 4096 /**< 메모리 Sink 초기 크기 (bytes) */
+
+typedef struct
+{
+    cc_sink_t _base;
+    char*     _data;
+    size_t    _len;
+    size_t    _cap;
+} memory_sink_t;
+
+static bool _memory_write( cc_sink_t* base, const char* data, size_t len )
+{
+    memory_sink_t* self = (memory_sink_t*)base;
+    if( len == 0 ) return true;
+
+    if( self->_len + len > self->_cap ){
+        size_t new_cap = ( self->_cap > 0 ) ? self->_cap * 2 : CC_SINK_MEMORY_INIT_CAP;
+        while( new_cap < self->_len + len ) new_cap *= 2;
+
+        char* new_data = (char*)realloc( self->_data, new_cap );
+        if( !new_data ) return false;
+        self->_data = new_data;
+        self->_cap  = new_cap;
+    }
+
+    memcpy( self->_data + self->_len, data, len );
+    self->_len += len;
+    return true;
+}
+
+static void _memory_destroy( cc_sink_t* base )
+{
+    memory_sink_t* self = (memory_sink_t*)base;
+    free( self->_data );
+    free( self );
+}
+
+static const cc_sink_ops_t _MEMORY_OPS = { _memory_write, NULL, NULL, NULL, _memory_destroy };
+
+// -----------------------------------------------------------------------------
+// File Sink
+// -----------------------------------------------------------------------------
+
+typedef struct
+{
+    cc_sink_t _base;
+    FILE*     _fp;
+    bool      _owns_file;
+} file_sink_t;
+
+static bool _file_write( cc_sink_t* base, const char* data, size_t len )
+{
+    file_sink_t* self = (file_sink_t*)base;
+    return fwrite( data, 1, len, self->_fp ) == len;
+}
+
+static void _file_flush( cc_sink_t* base )
+{
+    file_sink_t* self = (file_sink_t*)base;
+    fflush( self->_fp );
+}
+
+static void _file_destroy( cc_sink_t* base )
+{
+    file_sink_t* self = (file_sink_t*)base;
+    if( self->_owns_file ) fclose( self->_fp );
+    else                   fflush( self->_fp );
+    free( self );
+}
+
+static const cc_sink_ops_t _FILE_OPS = { _file_write, NULL, _file_flush, NULL, _file_destroy };
+
+// -----------------------------------------------------------------------------
+// Callback Sink
+// -----------------------------------------------------------------------------
+
+typedef struct
+{
+    cc_sink_t        _base;
+    cc_sink_write_fn _fn;
+    void*            _user;
+} callback_sink_t;
+
+static bool _callback_write( cc_sink_t* base, const char* data, size_t len )
+{
+    callback_sink_t* self = (callback_sink_t*)base;
+    return self->_fn( self->_user, data, len );
+}
+
+static void _callback_destroy( cc_sink_t* base )
+{
+    free( base );
+}
+
+static const cc_sink_ops_t _CALLBACK_OPS = { _callback_write, NULL, NULL, NULL, _callback_destroy };
+
+// -----------------------------------------------------------------------------
+// Public API Implementation
+// -----------------------------------------------------------------------------
+
+cc_sink_t* cc_sink_stdout( void )
+{
+    return &_stdout_sink._base;
+}
+
+cc_sink_t* cc_sink_create_fd( int fd, bool owns_fd )
+{
+    if( fd < 0 ) return NULL;
+
+    fd_sink_t* self = (fd_sink_t*)calloc( 1, sizeof( fd_sink_t ) );
+    if( !self ) return NULL;
+
+    self->_base._ops = &_FD_OPS;
+    self->_fd        = fd;
+    self->_owns_fd   = owns_fd;
+    return &self->_base;
+}
+
+cc_sink_t* cc_sink_create_memory( void )
+{
+    memory_sink_t* self = (memory_sink_t*)calloc( 1, sizeof( memory_sink_t ) );
+    if( !self ) return NULL;
+
+    self->_base._ops = &_MEMORY_OPS;
+    return &self->_base;
+}
+
+cc_sink_t* cc_sink_create_file( FILE* fp, bool owns_file )
+{
+    if( !fp ) return NULL;
+
+    file_sink_t* self = (file_sink_t*)calloc( 1, sizeof( file_sink_t ) );
+    if( !self ) return NULL;
+
+    self->_base._ops  = &_FILE_OPS;
+    self->_fp         = fp;
+    self->_owns_file  = owns_file;
+    return &self->_base;
+}
+
+cc_sink_t* cc_sink_create_callback( cc_sink_write_fn fn, void* user )
+{
+    if( !fn ) return NULL;
+
+    callback_sink_t* self = (callback_sink_t*)calloc( 1, sizeof( callback_sink_t ) );
+    if( !self ) return NULL;
+
+    self->_base._ops = &_CALLBACK_OPS;
+    self->_fn        = fn;
+    self->_user      = user;
+    return &self->_base;
+}
+
+void cc_sink_destroy( cc_sink_t* self )
+{
+    if( !self || self == cc_sink_stdout() ) return;
+    if( self->_ops->_destroy ) self->_ops->_destroy( self );
+}
+
+bool cc_sink_write( cc_sink_t* self, const char* data, size_t len )
+{
+    if( !self || ( !data && len > 0 ) ) return false;
+    return self->_ops->_write( self, data, len );
+}
+
+bool cc_sink_writev( cc_sink_t* self, const struct iovec* iov, int iovcnt )
+{
+    if( !self || ( !iov && iovcnt > 0 ) ) return false;
+    if( self->_ops->_writev ) return self->_ops->_writev( self, iov, iovcnt );
+
+    for( int i = 0; i < iovcnt; ++i ){
+        if( !self->_ops->_write( self, (const char*)iov[i].iov_base, iov[i].iov_len ) ) return false;
+    }
+    return true;
+}
+
+void cc_sink_flush( cc_sink_t* self )
+{
+    if( !self || !self->_ops->_flush ) return;
+    self->_ops->_flush( self );
+}
+
+void cc_sink_interrupt( cc_sink_t* self, bool interrupt )
+{
+    if( !self || !self->_ops->_interrupt ) return;
+    self->_ops->_interrupt( self, interrupt );
+}
+
+const char* cc_sink_memory_data( const cc_sink_t* self, size_t* out_len )
+{
+    const memory_sink_t* mem = ( self && self->_ops == &_MEMORY_OPS ) ? (const memory_sink_t*)self : NULL;
+    if( out_len ) *out_len = ( mem ) ? mem->_len : 0;
+    return ( mem && mem->_len > 0 ) ? mem->_data : NULL;
+}
+
+void cc_sink_memory_clear( cc_sink_t* self )
+{
+    if( !self || self->_ops != &_MEMORY_OPS ) return;
+    ( (memory_sink_t*)self )->_len = 0;
+}
\ No newline at end of file
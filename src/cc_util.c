@@ -5,6 +5,7 @@
  * ------------------------------------------------------------------------------------ */
 
 #include "console_c/cc_util.h"
+#include "cc_width_table.h" // tools/gen_width_table.py 로 생성
 
 #include <stdlib.h> // malloc, free, realloc, strtoul
 #include <string.h> // strlen, memcpy, strdup
@@ -31,6 +32,21 @@ static int _get_utf8_char_info( const char* str, uint32_t* out_codepoint )
         return 1;
     }
 
+    // 연속 바이트(10xxxxxx) 검증 (NULL 종료 문자를 넘어 읽지 않도록 함)
+    int need = ( ( c & 0xE0 ) == 0xC0 ) ? 1 :
+               ( ( c & 0xF0 ) == 0xE0 ) ? 2 :
+               ( ( c & 0xF8 ) == 0xF0 ) ? 3 : 0;
+    for( int k = 1; k <= need; ++k ){
+        if( ( (unsigned char)str[k] & 0xC0 ) != 0x80 ){
+            need = 0;
+            break;
+        }
+    }
+    if( need == 0 ){
+        if( out_codepoint ) *out_codepoint = 0;
+        return 1;
+    }
+
     // 2 Bytes (0x80 ~ 0x7FF)
     if( ( c & 0xE0 ) == 0xC0 ){
         val = ( c & 0x1F ) << 6;
@@ -64,28 +80,24 @@ static int _get_utf8_char_info( const char* str, uint32_t* out_codepoint )
 }
 
 /**
- * @brief 너비를 차지하지 않는 특수 문자(Zero Width)인지 확인합니다.
+ * @brief 코드포인트의 표시 너비를 2단계 표에서 조회 (0, 1, 2)
+ * @details 표는 tools/gen_width_table.py 가 Unicode 데이터로 생성합니다. (cc_width_table.h)
  */
-static bool _is_zero_width( uint32_t cp )
+static int _lookup_width( uint32_t cp )
 {
-    if( cp == 0 ) return true; // Null
-
-    // 1. ZWJ & ZWNJ
-    if( cp == 0x200C || cp == 0x200D ) return true;
+    if( cp >= 0x110000 ) return 1;
 
-    // 2. Variation Selectors
-    if( cp >= 0xFE00 && cp <= 0xFE0F ) return true;
-
-    // 3. Combining Diacritical Marks
-    if( cp >= 0x0300 && cp <= 0x036F ) return true;
-
-    // 4. Skin Tone Modifiers
-    if( cp >= 0x1F3FB && cp <= 0x1F3FF ) return true;
-
-    // 5. Tags for Emoji
-    if( cp >= 0xE0020 && cp <= 0xE007F ) return true;
+    uint8_t block = CC_WIDTH_STAGE1[cp >> CC_WIDTH_BLOCK_SHIFT];
+    uint8_t bits  = CC_WIDTH_STAGE2[block][( cp & 0xFF ) >> 2];
+    return ( bits >> ( ( cp & 3 ) * 2 ) ) & 3;
+}
 
-    return false;
+/**
+ * @brief 국기 이모지를 이루는 지역 표시 문자(Regional Indicator)인지 확인
+ */
+static bool _is_regional_indicator( uint32_t cp )
+{
+    return cp >= 0x1F1E6 && cp <= 0x1F1FF;
 }
 
 /**
@@ -123,28 +135,85 @@ static bool _string_list_add( cc_string_list_t* list, const char* str, size_t le
 
 bool cc_util_is_double_width( uint32_t cp )
 {
-    // 한글 범위 (Hangul Jamo, Syllables)
-    if( ( cp >= 0x1100 && cp <= 0x11FF ) ||
-        ( cp >= 0x3130 && cp <= 0x318F ) ||
-        ( cp >= 0xAC00 && cp <= 0xD7A3 ) ){
-        return true;
+    return _lookup_width( cp ) == 2;
+}
+
+int cc_util_get_codepoint_width( uint32_t cp )
+{
+    return _lookup_width( cp );
+}
+
+int cc_util_next_cluster( const char* str, int* out_width )
+{
+    if( !str || str[0] == '\0' ){
+        if( out_width ) *out_width = 0;
+        return 0;
     }
 
-    // CJK Unified Ideographs (한자)
-    if( cp >= 0x4E00 && cp <= 0x9FFF ) return true;
-    if( cp >= 0x3400 && cp <= 0x4DBF ) return true; // CJK Ext A
-    if( cp >= 0xF900 && cp <= 0xFAFF ) return true; // CJK Compatibility
+    uint32_t base = 0;
+    int      len  = _get_utf8_char_info( str, &base );
+    int      width = _lookup_width( base );
 
-    // Fullwidth Forms (전각 문자)
-    if( cp >= 0xFF01 && cp <= 0xFF60 ) return true;
-    if( cp >= 0xFFE0 && cp <= 0xFFE6 ) return true;
+    bool after_zwj = false;
+    bool wide_form = false; // VS16(이모지 표현) 또는 국기(지역 표시 문자 2개)
+    bool ri_open   = _is_regional_indicator( base );
 
-    // Emoji & Symbols (Supplemental)
-    if( cp >= 0x1F300 && cp <= 0x1F6FF ) return true;
-    if( cp >= 0x1F900 && cp <= 0x1F9FF ) return true; // Supplemental Symbols
-    if( cp >= 0x1F004 && cp <= 0x1F251 ) return true; // Enclosed CJK chars
+    while( str[len] != '\0' ){
+        uint32_t cp    = 0;
+        int      bytes = _get_utf8_char_info( &str[len], &cp );
+        if( cp == 0 ) break; // 잘못된 시퀀스는 다음 클러스터로
 
-    return false;
+        if( after_zwj || _lookup_width( cp ) == 0 ){
+            // ZWJ 다음 글자, 결합 문자/선택자/피부색 수식자 등은 앞 글자에 붙음
+            after_zwj = ( cp == 0x200D );
+            if( cp == 0xFE0F ) wide_form = true;
+        }
+        else if( ri_open && _is_regional_indicator( cp ) ){
+            ri_open   = false;
+            wide_form = true;
+        }
+        else{
+            break;
+        }
+        len += bytes;
+    }
+
+    if( width > 0 && wide_form ) width = 2;
+    if( out_width ) *out_width = width;
+    return len;
+}
+
+int cc_util_decode_utf8( const char* str, uint32_t* out_codepoint )
+{
+    if( !str ){
+        if( out_codepoint ) *out_codepoint = 0;
+        return 0;
+    }
+    return _get_utf8_char_info( str, out_codepoint );
+}
+
+int cc_util_encode_utf8( uint32_t cp, char* out_buf )
+{
+    if( cp < 0x80 ){
+        out_buf[0] = (char)cp;
+        return 1;
+    }
+    if( cp < 0x800 ){
+        out_buf[0] = (char)( 0xC0 | ( cp >> 6 ) );
+        out_buf[1] = (char)( 0x80 | ( cp & 0x3F ) );
+        return 2;
+    }
+    if( cp < 0x10000 ){
+        out_buf[0] = (char)( 0xE0 | ( cp >> 12 ) );
+        out_buf[1] = (char)( 0x80 | ( ( cp >> 6 ) & 0x3F ) );
+        out_buf[2] = (char)( 0x80 | ( cp & 0x3F ) );
+        return 3;
+    }
+    out_buf[0] = (char)( 0xF0 | ( ( cp >> 18 ) & 0x07 ) );
+    out_buf[1] = (char)( 0x80 | ( ( cp >> 12 ) & 0x3F ) );
+    out_buf[2] = (char)( 0x80 | ( ( cp >> 6 ) & 0x3F ) );
+    out_buf[3] = (char)( 0x80 | ( cp & 0x3F ) );
+    return 4;
 }
 
 size_t cc_util_get_string_width( const char* str )
@@ -174,20 +243,11 @@ size_t cc_util_get_string_width( const char* str )
             }
         }
 
-        // Get Char Info
-        uint32_t codepoint = 0;
-        int byte_len = _get_utf8_char_info( &str[i], &codepoint );
-
-        if( _is_zero_width( codepoint ) ){
-            // 너비 추가 없음
-        }
-        else if( cc_util_is_double_width( codepoint ) ){
-            width += 2;
-        }
-        else{
-            width += 1;
-        }
+        // Get Cluster Info (결합 문자, ZWJ 이모지 등은 한 글자로)
+        int cluster_width = 0;
+        int byte_len = cc_util_next_cluster( &str[i], &cluster_width );
 
+        width += (size_t)cluster_width;
         i += byte_len;
     }
 
@@ -298,10 +358,9 @@ bool cc_util_split_string_by_width( const char* str, size_t max_width, cc_string
 
         // 2. Character Check (ANSI가 아닐 경우)
         if( chunk_len == 0 ){
-            uint32_t cp = 0;
-            int bytes = _get_utf8_char_info( &str[i], &cp );
-            chunk_len = bytes;
-            chunk_width = cc_util_is_double_width( cp ) ? 2 : 1;
+            int cluster_width = 0;
+            chunk_len = (size_t)cc_util_next_cluster( &str[i], &cluster_width );
+            chunk_width = (size_t)cluster_width;
         }
 
         // 3. Wrap Check
@@ -0,0 +1,198 @@
+#!/usr/bin/env python3
+"""
+ConsoleC 문자 너비 표 생성기
+------------------------------------------------------------------------------------
+Unicode East Asian Width 와 General Category 데이터로 코드포인트별 표시 너비(0/1/2)를
+계산하여 2단계 조회 표(src/cc_width_table.h)를 만듭니다.
+
+  python3 tools/gen_width_table.py                      # 파이썬 내장 unicodedata 사용
+  python3 tools/gen_width_table.py --ucd path/to/ucd    # UCD 파일 사용 (최신 버전 반영 시)
+
+--ucd 디렉토리에는 EastAsianWidth.txt 와 DerivedGeneralCategory.txt
+(extracted/ 하위 폴더도 가능)가 있어야 합니다.
+
+표 구조:
+  stage1[cp >> 8]            -> stage2 블록 번호 (uint8_t)
+  stage2[block][(cp & 255) >> 2] -> 4개 코드포인트의 너비 (각 2비트)
+------------------------------------------------------------------------------------
+"""
+
+import argparse
+import os
+import sys
+
+MAX_CP      = 0x110000
+BLOCK_SHIFT = 8
+BLOCK_SIZE  = 1 << BLOCK_SHIFT
+
+# 미할당이어도 넓은 문자로 예약된 영역 (EastAsianWidth.txt 의 기본값 W 영역)
+DEFAULT_WIDE_RANGES = [
+    ( 0x3400, 0x4DBF ),   # CJK Ext A
+    ( 0x4E00, 0x9FFF ),   # CJK Unified Ideographs
+    ( 0xF900, 0xFAFF ),   # CJK Compatibility Ideographs
+    ( 0x20000, 0x2FFFD ), # Plane 2
+    ( 0x30000, 0x3FFFD ), # Plane 3
+]
+
+# 앞 글자와 합쳐져 표시되는 한글 자모 (중성/종성)
+HANGUL_COMBINING_RANGES = [
+    ( 0x1160, 0x11FF ),
+    ( 0xD7B0, 0xD7FF ),
+]
+
+# 이모지 피부색 수식자 (앞 이모지와 합쳐짐)
+EMOJI_MODIFIER_RANGE = ( 0x1F3FB, 0x1F3FF )
+
+
+def _parse_ucd_ranges( path ):
+    """UCD 형식 "XXXX..YYYY ; Value # comment" 파일을 (first, last, value) 목록으로 읽음"""
+    entries = []
+    with open( path, encoding='utf-8' ) as f:
+        for line in f:
+            line = line.split( '#', 1 )[0].strip()
+            if not line:
+                continue
+            cps, value = [ part.strip() for part in line.split( ';' )[:2] ]
+            if '..' in cps:
+                first, last = cps.split( '..' )
+            else:
+                first = last = cps
+            entries.append( ( int( first, 16 ), int( last, 16 ), value ) )
+    return entries
+
+
+def _find_ucd_file( ucd_dir, name ):
+    for candidate in ( os.path.join( ucd_dir, name ), os.path.join( ucd_dir, 'extracted', name ) ):
+        if os.path.exists( candidate ):
+            return candidate
+    sys.exit( 'missing %s in %s' % ( name, ucd_dir ) )
+
+
+def load_properties( ucd_dir ):
+    """코드포인트별 (east_asian_width, general_category) 배열과 Unicode 버전 문자열을 반환"""
+    eaw = [ 'N' ] * MAX_CP
+    cat = [ 'Cn' ] * MAX_CP
+
+    if ucd_dir:
+        for first, last, value in _parse_ucd_ranges( _find_ucd_file( ucd_dir, 'EastAsianWidth.txt' ) ):
+            for cp in range( first, last + 1 ):
+                eaw[cp] = value
+        for first, last, value in _parse_ucd_ranges( _find_ucd_file( ucd_dir, 'DerivedGeneralCategory.txt' ) ):
+            for cp in range( first, last + 1 ):
+                cat[cp] = value
+        version = 'UCD files (%s)' % os.path.abspath( ucd_dir )
+    else:
+        import unicodedata
+        for cp in range( MAX_CP ):
+            ch = chr( cp )
+            eaw[cp] = unicodedata.east_asian_width( ch )
+            cat[cp] = unicodedata.category( ch )
+        version = 'Unicode %s (python unicodedata)' % unicodedata.unidata_version
+
+    return eaw, cat, version
+
+
+def _in_ranges( cp, ranges ):
+    return any( first <= cp <= last for first, last in ranges )
+
+
+def codepoint_width( cp, eaw, cat ):
+    """터미널 표시 너비 (0 = 앞 글자에 합쳐짐, 1 = 반각, 2 = 전각)"""
+    if cp == 0:
+        return 0
+
+    c = cat[cp]
+    if c in ( 'Mn', 'Me' ):
+        return 0
+    if c == 'Cf' and cp != 0x00AD: # Soft Hyphen은 대부분의 터미널이 1칸으로 표시
+        return 0
+    if _in_ranges( cp, HANGUL_COMBINING_RANGES ):
+        return 0
+    if EMOJI_MODIFIER_RANGE[0] <= cp <= EMOJI_MODIFIER_RANGE[1]:
+        return 0
+
+    if eaw[cp] in ( 'W', 'F' ):
+        return 2
+    if c == 'Cn' and _in_ranges( cp, DEFAULT_WIDE_RANGES ):
+        return 2
+
+    return 1
+
+
+def build_tables( widths ):
+    """너비 배열을 (stage1, stage2 블록 목록)으로 압축 (같은 블록은 공유)"""
+    stage1 = []
+    blocks = []
+    index  = {}
+
+    for base in range( 0, MAX_CP, BLOCK_SIZE ):
+        packed = bytearray( BLOCK_SIZE // 4 )
+        for i in range( BLOCK_SIZE ):
+            packed[i >> 2] |= widths[base + i] << ( ( i & 3 ) * 2 )
+        key = bytes( packed )
+        if key not in index:
+            index[key] = len( blocks )
+            blocks.append( key )
+        stage1.append( index[key] )
+
+    if len( blocks ) > 256:
+        sys.exit( 'too many unique blocks (%d) for uint8_t stage1' % len( blocks ) )
+    return stage1, blocks
+
+
+def write_header( path, stage1, blocks, version ):
+    out = []
+    out.append( '/** ------------------------------------------------------------------------------------' )
+    out.append( ' * ConsoleC Character Width Table (Generated)' )
+    out.append( ' * ------------------------------------------------------------------------------------' )
+    out.append( ' * tools/gen_width_table.py 가 생성한 파일입니다. 직접 수정하지 마세요.' )
+    out.append( ' * Source: %s' % version )
+    out.append( ' * ------------------------------------------------------------------------------------ */' )
+    out.append( '' )
+    out.append( '#ifndef _CONSOLE_C_WIDTH_TABLE_H_' )
+    out.append( '#define _CONSOLE_C_WIDTH_TABLE_H_' )
+    out.append( '' )
+    out.append( '#include <stdint.h>' )
+    out.append( '' )
+    out.append( '#define CC_WIDTH_BLOCK_SHIFT %d' % BLOCK_SHIFT )
+    out.append( '#define CC_WIDTH_BLOCK_COUNT %d' % len( blocks ) )
+    out.append( '' )
+    out.append( '/** @brief 256개 코드포인트 단위 블록 -> stage2 블록 번호 */' )
+    out.append( 'static const uint8_t CC_WIDTH_STAGE1[%d] = {' % len( stage1 ) )
+    for i in range( 0, len( stage1 ), 16 ):
+        out.append( '    ' + ', '.join( '%3d' % v for v in stage1[i:i + 16] ) + ',' )
+    out.append( '};' )
+    out.append( '' )
+    out.append( '/** @brief 블록별 너비 (코드포인트당 2비트, 바이트 하나에 4개) */' )
+    out.append( 'static const uint8_t CC_WIDTH_STAGE2[%d][%d] = {' % ( len( blocks ), BLOCK_SIZE // 4 ) )
+    for block in blocks:
+        out.append( '    {' )
+        for i in range( 0, len( block ), 16 ):
+            out.append( '        ' + ', '.join( '0x%02X' % v for v in block[i:i + 16] ) + ',' )
+        out.append( '    },' )
+    out.append( '};' )
+    out.append( '' )
+    out.append( '#endif // _CONSOLE_C_WIDTH_TABLE_H_' )
+
+    with open( path, 'w', encoding='utf-8' ) as f:
+        f.write( '\n'.join( out ) )
+
+
+def main():
+    root = os.path.dirname( os.path.dirname( os.path.abspath( __file__ ) ) )
+
+    parser = argparse.ArgumentParser( description='Generate ConsoleC character width table' )
+    parser.add_argument( '--ucd', help='directory containing EastAsianWidth.txt and DerivedGeneralCategory.txt' )
+    parser.add_argument( '--output', default=os.path.join( root, 'src', 'cc_width_table.h' ) )
+    args = parser.parse_args()
+
+    eaw, cat, version = load_properties( args.ucd )
+    widths = [ codepoint_width( cp, eaw, cat ) for cp in range( MAX_CP ) ]
+    stage1, blocks = build_tables( widths )
+    write_header( args.output, stage1, blocks, version )
+
+    print( '%s: %d blocks, %d bytes' % ( args.output, len( blocks ), len( stage1 ) + len( blocks ) * BLOCK_SIZE // 4 ) )
+
+
+if __name__ == '__main__':
+    main()